@@ -0,0 +1,118 @@
+/*<-
+Copyright Barrett Adair 2016
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http ://boost.org/LICENSE_1_0.txt)
+->*/
+
+// Compares constexpr_transform, constexpr_reduce and
+// constexpr_inclusive_scan with std::transform, std::accumulate and
+// std::partial_sum on arrays of 16 to 16M elements, and prints the time
+// per pass over the array as JSON. Pass --quick for a short run that
+// stops at 64K elements. Build with optimizations and -pthread, e.g.
+// g++ -std=c++17 -O2 -pthread -I. -I<callable_traits>.
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <numeric>
+#include <string>
+#include <vector>
+#include "constexpr_checks/algorithm.hpp"
+#include "benchmark.hpp"
+
+using namespace constexpr_checks;
+
+struct square {
+    constexpr unsigned operator()(unsigned i) const { return i * i; }
+};
+
+struct plus {
+    constexpr unsigned operator()(unsigned a, unsigned b) const {
+        return a + b;
+    }
+};
+
+template<std::size_t N>
+void run(const bench::options& quick, std::vector<bench::result>& results) {
+
+    using array = std::array<unsigned, N>;
+
+    auto in = std::unique_ptr<array>(new array);
+    auto out = std::unique_ptr<array>(new array);
+
+    for (std::size_t i = 0; i < N; ++i)
+        (*in)[i] = static_cast<unsigned>(i * 2654435761u);
+
+    // roughly the same number of elements are processed for every size
+    bench::options o = quick;
+    o.iterations = std::max<std::size_t>(1, (quick.iterations << 4) / N);
+
+    std::string size = std::to_string(N);
+
+    results.push_back(bench::measure("std::transform/" + size, "runtime", o,
+        [&](std::size_t n) {
+            for (std::size_t i = 0; i < n; ++i) {
+                std::transform(in->begin(), in->end(), out->begin(),
+                    square{});
+                bench::do_not_optimize(out->data());
+            }
+        }));
+
+    results.push_back(bench::measure("constexpr_transform/" + size,
+        "runtime", o, [&](std::size_t n) {
+            for (std::size_t i = 0; i < n; ++i) {
+                constexpr_transform(*in, *out, square{});
+                bench::do_not_optimize(out->data());
+            }
+        }));
+
+    results.push_back(bench::measure("std::accumulate/" + size, "runtime", o,
+        [&](std::size_t n) {
+            for (std::size_t i = 0; i < n; ++i)
+                bench::do_not_optimize(std::accumulate(
+                    in->begin(), in->end(), 0u, plus{}));
+        }));
+
+    results.push_back(bench::measure("constexpr_reduce/" + size,
+        "runtime", o, [&](std::size_t n) {
+            for (std::size_t i = 0; i < n; ++i)
+                bench::do_not_optimize(constexpr_reduce(*in, 0u, plus{}));
+        }));
+
+    results.push_back(bench::measure("std::partial_sum/" + size, "runtime",
+        o, [&](std::size_t n) {
+            for (std::size_t i = 0; i < n; ++i) {
+                std::partial_sum(in->begin(), in->end(), out->begin(),
+                    plus{});
+                bench::do_not_optimize(out->data());
+            }
+        }));
+
+    results.push_back(bench::measure("constexpr_inclusive_scan/" + size,
+        "runtime", o, [&](std::size_t n) {
+            for (std::size_t i = 0; i < n; ++i) {
+                constexpr_inclusive_scan(*in, *out, plus{});
+                bench::do_not_optimize(out->data());
+            }
+        }));
+}
+
+int main(int argc, char** argv) {
+
+    bench::options o = bench::parse_options(argc, argv);
+    bool quick = o.iterations < bench::options{}.iterations;
+    std::vector<bench::result> results;
+
+    run<16>(o, results);
+    run<256>(o, results);
+    run<4096>(o, results);
+    run<65536>(o, results);
+
+    if (!quick) {
+        run<(1 << 20)>(o, results);
+        run<(1 << 24)>(o, results);
+    }
+
+    bench::write_json(stdout, "algorithm", results);
+}
@@ -0,0 +1,131 @@
+/*<-
+Copyright Barrett Adair 2016
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http ://boost.org/LICENSE_1_0.txt)
+->*/
+
+// A minimal, dependency-free timing harness for the programs in bench/.
+// Each benchmark body is run for a few warmup repetitions, then timed
+// over many repetitions, and summarized by the median, p99, min and
+// mean time per operation. Results are written as JSON.
+
+#ifndef CONSTEXPR_CHECKS_BENCH_BENCHMARK_HPP
+#define CONSTEXPR_CHECKS_BENCH_BENCHMARK_HPP
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace bench {
+
+    // Keeps the optimizer from discarding 'value' or the computation
+    // that produced it, without adding a memory round trip. For large
+    // objects, pass a pointer instead - the memory clobber still forces
+    // every write through it to happen.
+    template<typename T>
+    inline void do_not_optimize(const T& value) {
+#if defined(__GNUC__) || defined(__clang__)
+        asm volatile("" : : "r,m"(value) : "memory");
+#else
+        static volatile const void* sink;
+        sink = &value;
+#endif
+    }
+
+    struct options {
+        std::size_t warmup = 3;
+        std::size_t repetitions = 31;
+        std::size_t iterations = std::size_t{ 1 } << 20;
+    };
+
+    // --quick runs fewer and shorter repetitions, e.g. for smoke tests
+    inline options parse_options(int argc, char** argv) {
+        options o;
+        for (int i = 1; i < argc; ++i) {
+            if (std::strcmp(argv[i], "--quick") == 0) {
+                o.warmup = 1;
+                o.repetitions = 5;
+                o.iterations = std::size_t{ 1 } << 12;
+            }
+        }
+        return o;
+    }
+
+    struct result {
+        std::string name;
+        std::string mode;
+        std::size_t iterations;
+        std::size_t repetitions;
+        double median_ns;
+        double p99_ns;
+        double min_ns;
+        double mean_ns;
+    };
+
+    // body(n) must perform n operations
+    template<typename Body>
+    inline result measure(std::string name, std::string mode,
+        const options& o, Body&& body) {
+
+        using clock = std::chrono::steady_clock;
+
+        for (std::size_t i = 0; i < o.warmup; ++i)
+            body(o.iterations);
+
+        std::vector<double> samples;
+        samples.reserve(o.repetitions);
+
+        for (std::size_t i = 0; i < o.repetitions; ++i) {
+            auto start = clock::now();
+            body(o.iterations);
+            auto stop = clock::now();
+            samples.push_back(std::chrono::duration<double, std::nano>(
+                stop - start).count() / o.iterations);
+        }
+
+        std::sort(samples.begin(), samples.end());
+
+        double sum = 0;
+        for (double s : samples)
+            sum += s;
+
+        auto percentile = [&samples](double p) {
+            std::size_t rank = static_cast<std::size_t>(
+                p * static_cast<double>(samples.size()) + 0.5);
+            return samples[rank == 0 ? 0 : std::min(rank, samples.size()) - 1];
+        };
+
+        return result{ std::move(name), std::move(mode), o.iterations,
+            o.repetitions, percentile(0.5), percentile(0.99),
+            samples.front(), sum / static_cast<double>(samples.size()) };
+    }
+
+    inline void write_json(std::FILE* out, const char* benchmark,
+        const std::vector<result>& results) {
+
+        std::fprintf(out, "{\n  \"benchmark\": \"%s\",\n  \"results\": [",
+            benchmark);
+
+        const char* separator = "\n";
+        for (const result& r : results) {
+            std::fprintf(out, "%s    {\"name\": \"%s\", \"mode\": \"%s\", "
+                "\"iterations\": %zu, \"repetitions\": %zu, "
+                "\"median_ns\": %.4f, \"p99_ns\": %.4f, "
+                "\"min_ns\": %.4f, \"mean_ns\": %.4f, "
+                "\"ops_per_second\": %.1f}",
+                separator, r.name.c_str(), r.mode.c_str(), r.iterations,
+                r.repetitions, r.median_ns, r.p99_ns, r.min_ns, r.mean_ns,
+                r.median_ns > 0 ? 1e9 / r.median_ns : 0.0);
+            separator = ",\n";
+        }
+
+        std::fprintf(out, "\n  ]\n}\n");
+    }
+}
+
+#endif //#ifndef CONSTEXPR_CHECKS_BENCH_BENCHMARK_HPP
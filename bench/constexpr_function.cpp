@@ -0,0 +1,71 @@
+/*<-
+Copyright Barrett Adair 2016
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http ://boost.org/LICENSE_1_0.txt)
+->*/
+
+// Compares the cost of an indirect call through a raw function pointer,
+// constexpr_function, constexpr_function_ref and std::function, and prints
+// the results as JSON. Pass --quick for a short run. Build with
+// optimizations, e.g. g++ -std=c++14 -O2 -I. -I<callable_traits>.
+
+#include <functional>
+#include <type_traits>
+#include <vector>
+#include "constexpr_checks/function.hpp"
+#include "benchmark.hpp"
+
+using constexpr_checks::constexpr_function;
+using constexpr_checks::constexpr_function_ref;
+
+constexpr long add_one(long i) { return i + 1; }
+
+struct add_two {
+    constexpr long operator()(long i) const { return i + 2; }
+};
+
+struct add_n {
+    long n;
+    constexpr long operator()(long i) const { return i + n; }
+};
+
+// the volatile index keeps the optimizer from devirtualizing calls
+volatile int which = 0;
+
+template<typename F>
+bench::result run(const char* name, F (&targets)[2],
+    const bench::options& o) {
+
+    return bench::measure(name, "latency", o, [&targets](std::size_t n) {
+        const F& f = targets[which];
+        long value = 0;
+        for (std::size_t i = 0; i < n; ++i)
+            value = f(value);
+        bench::do_not_optimize(value);
+    });
+}
+
+int main(int argc, char** argv) {
+
+    using add_one_c = std::integral_constant<decltype(&add_one), &add_one>;
+    add_n three{ 3 };
+
+    long (*raw[2])(long) = { &add_one, &add_one };
+    std::function<long(long)> std_function[2] = { &add_one, add_n{ 3 } };
+    constexpr_function<long(long)> pointer[2] = { &add_one, &add_one };
+    constexpr_function<long(long)> constant[2] = { add_one_c{}, add_two{} };
+    constexpr_function<long(long)> object[2] = { add_n{ 3 }, add_n{ 4 } };
+    constexpr_function_ref<long(long)> ref[2] = { three, add_two{} };
+
+    bench::options o = bench::parse_options(argc, argv);
+    std::vector<bench::result> results;
+
+    results.push_back(run("raw_function_pointer", raw, o));
+    results.push_back(run("std_function", std_function, o));
+    results.push_back(run("constexpr_function_pointer", pointer, o));
+    results.push_back(run("constexpr_function_constant", constant, o));
+    results.push_back(run("constexpr_function_object", object, o));
+    results.push_back(run("constexpr_function_ref", ref, o));
+
+    bench::write_json(stdout, "constexpr_function", results);
+}
@@ -0,0 +1,109 @@
+/*<-
+Copyright Barrett Adair 2016
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http ://boost.org/LICENSE_1_0.txt)
+->*/
+
+// Measures the runtime payoff of folding a constexpr-invokable call at
+// compile time, for the kinds of callables used in test/ and example/:
+// a function pointer, a pointer to member function and a generic function
+// object. Each callable is measured
+//
+//   folded             - its result is an std::integral_constant, so the
+//                        loop only consumes a constant
+//   runtime_latency    - chained calls on a volatile input, x = f(x)
+//   runtime_throughput - independent calls on volatile inputs
+//
+// and the results are printed as JSON. Pass --quick for a short run.
+// Build with optimizations, e.g. g++ -std=c++14 -O2 -I. -I<callable_traits>.
+
+#include <cstddef>
+#include <cstdio>
+#include <type_traits>
+#include <vector>
+#include "constexpr_checks.hpp"
+#include "benchmark.hpp"
+
+using constexpr_checks::is_constexpr_invokable;
+
+// shaped like 'bar' in test/is_constexpr_invokable.cpp, with enough of a
+// body that a runtime call is not free
+constexpr int bar(const int& i) {
+    unsigned h = static_cast<unsigned>(i);
+    for (int round = 0; round < 4; ++round)
+        h = (h ^ (h >> 15)) * 0x2c1b3c6du;
+    return static_cast<int>(h >> 1);
+}
+
+// shaped like 'foo3' in test/is_constexpr_invokable.cpp
+struct foo3 {
+    constexpr int bar(int i) const {
+        return ::bar(i) ^ 0x55;
+    }
+};
+
+// shaped like 'subtract' in example/is_constexpr_function_object.cpp
+struct subtract {
+    template<typename T1, typename T2>
+    constexpr auto operator()(T1 t1, T2 t2) const -> decltype(t1 - t2) {
+        return t1 - t2;
+    }
+};
+
+using bar_c = std::integral_constant<decltype(&bar), &bar>;
+using foo3_pmf = std::integral_constant<decltype(&foo3::bar), &foo3::bar>;
+
+// the folded paths below are only valid because these hold
+static_assert(is_constexpr_invokable<bar_c, int>(), "");
+static_assert(is_constexpr_invokable<foo3_pmf, foo3&, int>(), "");
+static_assert(is_constexpr_invokable<subtract, int, int>(), "");
+
+constexpr int input = 42;
+
+volatile int runtime_input = input;
+
+template<int Folded, typename F>
+void compare(const char* name, F f, const bench::options& o,
+    std::vector<bench::result>& results) {
+
+    using folded = std::integral_constant<int, Folded>;
+
+    results.push_back(bench::measure(name, "folded", o,
+        [](std::size_t n) {
+            for (std::size_t i = 0; i < n; ++i)
+                bench::do_not_optimize(folded::value);
+        }));
+
+    results.push_back(bench::measure(name, "runtime_latency", o,
+        [f](std::size_t n) {
+            int x = runtime_input;
+            for (std::size_t i = 0; i < n; ++i) {
+                x = f(x);
+                bench::do_not_optimize(x);
+            }
+        }));
+
+    results.push_back(bench::measure(name, "runtime_throughput", o,
+        [f](std::size_t n) {
+            int base = runtime_input;
+            for (std::size_t i = 0; i < n; ++i)
+                bench::do_not_optimize(f(base + static_cast<int>(i)));
+        }));
+}
+
+int main(int argc, char** argv) {
+
+    bench::options o = bench::parse_options(argc, argv);
+    std::vector<bench::result> results;
+
+    compare<bar_c::value(input)>("function_pointer",
+        [](int x) { return bar_c::value(x); }, o, results);
+
+    compare<(foo3{}.*foo3_pmf::value)(input)>("member_function_pointer",
+        [](int x) { return (foo3{}.*foo3_pmf::value)(x); }, o, results);
+
+    compare<subtract{}(input, 7)>("function_object",
+        [](int x) { return subtract{}(x, 7); }, o, results);
+
+    bench::write_json(stdout, "folding", results);
+}
@@ -0,0 +1,114 @@
+/*<-
+Copyright Barrett Adair 2016
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http ://boost.org/LICENSE_1_0.txt)
+->*/
+
+// Compares eytzinger_index::lower_bound with std::lower_bound over a
+// sorted std::array, for 256 to 256K keys, and prints the time per lookup
+// as JSON. The 256-key index is built at compile time, the others at
+// runtime; the layout is the same. Pass --quick for a short run. Build
+// with optimizations, e.g. g++ -std=c++14 -O2 -I. -I<callable_traits>.
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+#include "constexpr_checks/sorted_index.hpp"
+#include "benchmark.hpp"
+
+using constexpr_checks::eytzinger_index;
+
+// the odd numbers below 2N, shuffled
+inline constexpr unsigned odd_key(std::size_t i, std::size_t n) {
+    return static_cast<unsigned>(((i * 2654435761u) % n) * 2 + 1);
+}
+
+template<std::size_t N, typename Seq = std::make_index_sequence<N>>
+struct odd_keys;
+
+template<std::size_t N, std::size_t... I>
+struct odd_keys<N, std::index_sequence<I...>> {
+    constexpr std::array<unsigned, N> operator()() const {
+        return {{ odd_key(I, N)... }};
+    }
+};
+
+using small_index = constexpr_checks::static_sorted_index<odd_keys<256>>;
+
+static_assert(small_index::is_constexpr::value, "");
+
+// pseudo-random lookups in [0, 2N], about half of them hits
+std::vector<unsigned> make_queries(std::size_t n) {
+    std::vector<unsigned> queries(4096);
+    unsigned x = 12345;
+    for (unsigned& q : queries) {
+        x = x * 1103515245u + 12345u;
+        q = static_cast<unsigned>((x >> 8) % (2 * n + 1));
+    }
+    return queries;
+}
+
+template<std::size_t N>
+std::unique_ptr<std::array<unsigned, N>> make_keys() {
+    auto keys = std::unique_ptr<std::array<unsigned, N>>(
+        new std::array<unsigned, N>);
+    for (std::size_t i = 0; i < N; ++i)
+        (*keys)[i] = odd_key(i, N);
+    return keys;
+}
+
+template<std::size_t N, typename Index>
+void compare(const Index& index, const bench::options& o,
+    std::vector<bench::result>& results) {
+
+    auto sorted = make_keys<N>();
+    std::sort(sorted->begin(), sorted->end());
+
+    std::vector<unsigned> queries = make_queries(N);
+    std::string size = std::to_string(N);
+
+    results.push_back(bench::measure("std::lower_bound/" + size, "runtime",
+        o, [&](std::size_t n) {
+            for (std::size_t i = 0; i < n; ++i)
+                bench::do_not_optimize(std::lower_bound(sorted->begin(),
+                    sorted->end(), queries[i % queries.size()]));
+        }));
+
+    results.push_back(bench::measure("eytzinger_index/" + size, "runtime",
+        o, [&](std::size_t n) {
+            for (std::size_t i = 0; i < n; ++i)
+                bench::do_not_optimize(index.lower_bound(
+                    queries[i % queries.size()]));
+        }));
+}
+
+template<std::size_t N>
+void run_runtime(const bench::options& o,
+    std::vector<bench::result>& results) {
+
+    using index_type = eytzinger_index<unsigned, N>;
+
+    auto index = std::unique_ptr<index_type>(
+        new index_type(*make_keys<N>()));
+
+    compare<N>(*index, o, results);
+}
+
+int main(int argc, char** argv) {
+
+    bench::options o = bench::parse_options(argc, argv);
+    std::vector<bench::result> results;
+
+    compare<256>(small_index::get(), o, results);
+
+    run_runtime<4096>(o, results);
+    run_runtime<65536>(o, results);
+    run_runtime<262144>(o, results);
+
+    bench::write_json(stdout, "sorted_index", results);
+}
@@ -0,0 +1,156 @@
+/*<-
+Copyright Barrett Adair 2016
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http ://boost.org/LICENSE_1_0.txt)
+->*/
+
+// Measures the startup cost of a static_config over a config of about
+// 300 KB: parsing it at runtime, as a service would at startup, against
+// getting the table that was parsed at compile time. Both modes use the
+// same parser; the runtime one only hides it from the constexpr probe.
+// Results are printed as JSON. Pass --quick for a short run. Build with
+// optimizations, e.g. g++ -std=c++14 -O2 -I. -I<callable_traits>.
+
+#include <cstddef>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+#include "constexpr_checks/static_config.hpp"
+#include "benchmark.hpp"
+
+using constexpr_checks::static_config;
+using constexpr_checks::text;
+
+// "service-00000=12345\n", one line per service
+constexpr std::size_t line_size = 20;
+constexpr std::size_t services = 15000;
+
+struct blob {
+    char data[line_size * services];
+};
+
+inline constexpr void
+put_digits(char* out, std::size_t value, std::size_t width) {
+    for (std::size_t i = width; i != 0; --i) {
+        out[i - 1] = static_cast<char>('0' + value % 10);
+        value /= 10;
+    }
+}
+
+inline constexpr blob generate() {
+    blob b{};
+    for (std::size_t i = 0; i < services; ++i) {
+        char* line = b.data + i * line_size;
+        const char name[] = "service-";
+        for (std::size_t j = 0; j < 8; ++j)
+            line[j] = name[j];
+        put_digits(line + 8, i, 5);
+        line[13] = '=';
+        put_digits(line + 14, 1024 + (i * 2654435761u) % 60000, 5);
+        line[19] = '\n';
+    }
+    return b;
+}
+
+// stands in for a raw string literal or an #embed array
+template<typename = void>
+struct embedded {
+    static constexpr blob value = generate();
+};
+
+template<typename T>
+constexpr blob embedded<T>::value;
+
+struct config {
+    constexpr text operator()() const {
+        return embedded<>::value.data;
+    }
+};
+
+struct route {
+    text name;
+    unsigned port;
+};
+
+struct routes {
+    std::size_t size;
+    route table[services];
+};
+
+inline constexpr unsigned parse_port(text t) {
+    unsigned result = 0;
+    for (char c : t) {
+        if (c < '0' || c > '9')
+            throw std::invalid_argument("bad port");
+        result = result * 10 + static_cast<unsigned>(c - '0');
+    }
+    return result;
+}
+
+struct parse {
+    constexpr routes operator()(text t) const {
+        routes r{};
+        std::size_t pos = 0;
+        while (pos < t.size()) {
+            std::size_t eol = t.find('\n', pos);
+            text line = t.substr(pos, eol - pos);
+            pos = eol == text::npos ? t.size() : eol + 1;
+            std::size_t eq = line.find('=');
+            if (eq == text::npos || r.size == services)
+                throw std::invalid_argument("bad line");
+            r.table[r.size++] = route{ line.substr(0, eq),
+                parse_port(line.substr(eq + 1)) };
+        }
+        return r;
+    }
+};
+
+struct runtime_parse {
+    routes operator()(text t) const { return parse{}(t); }
+};
+
+using compile_time = static_config<config, parse>;
+using run_time = static_config<config, runtime_parse>;
+
+static_assert(compile_time::is_constexpr::value, "");
+static_assert(!run_time::is_constexpr::value, "");
+static_assert(compile_time::value.size == services, "");
+
+int main(int argc, char** argv) {
+
+    bench::options o = bench::parse_options(argc, argv);
+    bool quick = o.iterations < bench::options{}.iterations;
+    std::vector<bench::result> results;
+
+    // one iteration is one whole startup parse
+    bench::options startup = o;
+    startup.iterations = quick ? 2 : 64;
+
+    auto parsed = std::unique_ptr<routes>(new routes);
+
+    results.push_back(bench::measure("parse at startup", "runtime",
+        startup, [&](std::size_t n) {
+            for (std::size_t i = 0; i < n; ++i) {
+                *parsed = runtime_parse{}(config{}());
+                bench::do_not_optimize(parsed.get());
+            }
+        }));
+
+    results.push_back(bench::measure("static_config::get", "runtime", o,
+        [](std::size_t n) {
+            for (std::size_t i = 0; i < n; ++i)
+                bench::do_not_optimize(&run_time::get());
+        }));
+
+    results.push_back(bench::measure("static_config::get", "constexpr", o,
+        [](std::size_t n) {
+            for (std::size_t i = 0; i < n; ++i)
+                bench::do_not_optimize(&compile_time::get());
+        }));
+
+    if (run_time::get().size != services
+        || compile_time::get().table[42].port != parsed->table[42].port)
+        return 1;
+
+    bench::write_json(stdout, "static_config", results);
+}
@@ -0,0 +1,114 @@
+/*<-
+Copyright Barrett Adair 2016
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http ://boost.org/LICENSE_1_0.txt)
+->*/
+
+// Compares std::visit with constexpr_visit over an array of message
+// variants of 4 and 12 alternatives, with a constexpr visitor (table
+// dispatch) and a runtime visitor (branch dispatch, or std::visit for the
+// wide variant), and prints the time per visit as JSON. Pass --quick for a short run. Build with optimizations, e.g.
+// g++ -std=c++17 -O2 -I. -I<callable_traits>.
+
+#include <cstddef>
+#include <cstdio>
+#include <initializer_list>
+#include <string>
+#include <utility>
+#include <vector>
+#include "constexpr_checks/visit.hpp"
+#include "benchmark.hpp"
+
+#ifdef __cpp_lib_variant
+
+using constexpr_checks::constexpr_visit;
+using constexpr_checks::is_constexpr_visitor;
+
+template<std::size_t I>
+struct msg { unsigned payload = I; };
+
+using narrow = std::variant<msg<0>, msg<1>, msg<2>, msg<3>>;
+
+using wide = std::variant<msg<0>, msg<1>, msg<2>, msg<3>, msg<4>, msg<5>,
+    msg<6>, msg<7>, msg<8>, msg<9>, msg<10>, msg<11>>;
+
+struct constexpr_visitor {
+    template<std::size_t I>
+    constexpr unsigned operator()(const msg<I>& m) const {
+        return m.payload * (I + 1);
+    }
+};
+
+unsigned volatile scale = 3;
+
+struct runtime_visitor {
+    template<std::size_t I>
+    unsigned operator()(const msg<I>& m) const {
+        return m.payload * (I + scale);
+    }
+};
+
+static_assert(is_constexpr_visitor<constexpr_visitor, const wide&>(), "");
+static_assert(!is_constexpr_visitor<runtime_visitor, const wide&>(), "");
+
+template<typename Variant, std::size_t... I>
+Variant make_message(std::size_t index, std::index_sequence<I...>) {
+    Variant result;
+    static_cast<void>(std::initializer_list<int>{
+        (index == I ? (result.template emplace<I>(), 0) : 0)... });
+    return result;
+}
+
+// random alternatives, so that the branch predictor can't learn the order
+template<typename Variant>
+std::vector<Variant> make_messages(std::size_t n) {
+    std::vector<Variant> messages;
+    unsigned x = 12345;
+    for (std::size_t i = 0; i < n; ++i) {
+        x = x * 1103515245u + 12345u;
+        messages.push_back(make_message<Variant>(
+            (x >> 16) % std::variant_size<Variant>::value,
+            std::make_index_sequence<std::variant_size<Variant>::value>{}));
+    }
+    return messages;
+}
+
+template<typename Variant, typename Visitor>
+void compare(const std::string& name, Visitor vis, const bench::options& o,
+    std::vector<bench::result>& results) {
+
+    std::vector<Variant> messages = make_messages<Variant>(1024);
+
+    results.push_back(bench::measure("std::visit/" + name, "runtime", o,
+        [&](std::size_t n) {
+            for (std::size_t i = 0; i < n; ++i)
+                bench::do_not_optimize(std::visit(vis,
+                    messages[i % messages.size()]));
+        }));
+
+    results.push_back(bench::measure("constexpr_visit/" + name, "runtime",
+        o, [&](std::size_t n) {
+            for (std::size_t i = 0; i < n; ++i)
+                bench::do_not_optimize(constexpr_visit(vis,
+                    messages[i % messages.size()]));
+        }));
+}
+
+int main(int argc, char** argv) {
+
+    bench::options o = bench::parse_options(argc, argv);
+    std::vector<bench::result> results;
+
+    compare<narrow>("narrow/constexpr", constexpr_visitor{}, o, results);
+    compare<narrow>("narrow/runtime", runtime_visitor{}, o, results);
+    compare<wide>("wide/constexpr", constexpr_visitor{}, o, results);
+    compare<wide>("wide/runtime", runtime_visitor{}, o, results);
+
+    bench::write_json(stdout, "visit", results);
+}
+
+#else
+
+int main() {}
+
+#endif //#ifdef __cpp_lib_variant
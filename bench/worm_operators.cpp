@@ -0,0 +1,74 @@
+/*<-
+Copyright Barrett Adair 2016
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http ://boost.org/LICENSE_1_0.txt)
+->*/
+
+// A compile-time benchmark: probes CONSTEXPR_CHECKS_BENCH_KERNELS
+// operator-heavy generic callables with is_constexpr and
+// is_constexpr_invokable, so that compiling this file is dominated by
+// overload resolution of operators on the probe worms. Measure it with
+// e.g.
+//
+//   time g++ -std=c++14 -fsyntax-only -I. -I<callable_traits> bench/worm_operators.cpp
+//
+// Running the program only prints the number of kernels as JSON.
+
+#include <cstddef>
+#include <cstdio>
+#include <utility>
+#include "constexpr_checks.hpp"
+
+#ifndef CONSTEXPR_CHECKS_BENCH_KERNELS
+#define CONSTEXPR_CHECKS_BENCH_KERNELS 200
+#endif
+
+using constexpr_checks::is_constexpr;
+using constexpr_checks::is_constexpr_invokable;
+
+template<std::size_t N>
+struct kernel {
+    template<typename T, typename U, typename V>
+    constexpr auto operator()(T t, U u, V v) const {
+        auto acc = t * u + v;
+        acc += (t - u) / (v | 1) % (u | 2) + N;
+        acc -= (t << 1) | ((u >> 1) ^ (v & t));
+        acc *= (t < u) + (u > v) + (t <= v) + (u >= t);
+        acc /= (t == u) + (u != v) + !t + ~u + -v;
+        ++acc;
+        acc--;
+        return (acc && t) || (acc ^ u);
+    }
+};
+
+template<typename Seq>
+struct probe_all;
+
+template<std::size_t... I>
+struct probe_all<std::index_sequence<I...>> {
+
+    static constexpr bool values[] = {
+        decltype(is_constexpr<kernel<I>>())::value...,
+        decltype(is_constexpr_invokable<kernel<I>, int, int, int>())::value...
+    };
+
+    static constexpr bool all() {
+        for (bool b : values)
+            if (!b)
+                return false;
+        return true;
+    }
+};
+
+template<std::size_t... I>
+constexpr bool probe_all<std::index_sequence<I...>>::values[];
+
+using kernels =
+    probe_all<std::make_index_sequence<CONSTEXPR_CHECKS_BENCH_KERNELS>>;
+
+static_assert(kernels::all(), "");
+
+int main() {
+    std::printf("{\n  \"benchmark\": \"worm_operators\",\n"
+        "  \"kernels\": %d\n}\n", CONSTEXPR_CHECKS_BENCH_KERNELS);
+}
@@ -65,7 +65,7 @@ namespace constexpr_checks {
 
         template<typename T, typename... Ts>
         struct conjunction<T, Ts...> : std::conditional<
-            T::value != false, T, conjunction<Ts...>>::type{};
+            T::value != false, conjunction<Ts...>, T>::type{};
 
 #define CONSTEXPR_CHECKS_NEGATION(...) \
     ::constexpr_checks::detail::negation<__VA_ARGS__>
@@ -84,11 +84,48 @@ namespace constexpr_checks {
             typename std::remove_reference<T>::type>::type;
 
         template<typename T, typename U = shallow_decay<T>>
-        using is_constexpr_constructible =
+        using is_default_constexpr_constructible =
             std::integral_constant<bool,
             std::is_literal_type<U>::value
             && std::is_default_constructible<U>::value>;
 
+        template<typename T>
+        struct decays_to_function_pointer {
+
+            template<typename U,
+                typename P = decltype(+std::declval<const U&>())>
+            static std::integral_constant<bool,
+                std::is_pointer<P>::value && std::is_function<
+                typename std::remove_pointer<P>::type>::value> test(int);
+
+            template<typename>
+            static std::false_type test(...);
+
+            static constexpr const bool value =
+                decltype(test<T>(0))::value;
+        };
+
+        // Closure types of capture-less lambdas are not default
+        // constructible before C++20, so we recognize them by their
+        // conversion to a function pointer instead. Generic lambdas
+        // have no such conversion without knowing the argument types,
+        // so they are only supported when they are default
+        // constructible.
+        template<typename T, typename U = shallow_decay<T>>
+        using is_captureless_lambda =
+            std::integral_constant<bool,
+            std::is_class<U>::value
+            && std::is_empty<U>::value
+            && std::is_literal_type<U>::value
+            && !std::is_default_constructible<U>::value
+            && decays_to_function_pointer<U>::value>;
+
+        template<typename T, typename U = shallow_decay<T>>
+        using is_constexpr_constructible =
+            std::integral_constant<bool,
+            is_default_constexpr_constructible<U>::value
+            || is_captureless_lambda<U>::value>;
+
         template<typename T>
         struct is_integral_constant : std::false_type {};
 
@@ -214,7 +251,7 @@ namespace constexpr_checks {
         };
 
         template<typename T>
-        struct make_constexpr<T, typename is_constexpr_constructible<
+        struct make_constexpr<T, typename is_default_constexpr_constructible<
             shallow_decay<T>>::type> {
 
             using decayed = shallow_decay<T>;
@@ -226,9 +263,27 @@ namespace constexpr_checks {
                 decayed&&, decayed&>::type;
         };
 
+        template<typename T>
+        struct make_constexpr<T, typename is_captureless_lambda<
+            shallow_decay<T>>::type> {
+
+            using decayed = shallow_decay<T>;
+
+            // A capture-less closure has no state for the call operator
+            // to read, so naming this object in a constant expression is
+            // enough. It is deliberately never defined - it has no
+            // constructor we could call.
+            static const decayed value;
+
+            using const_cast_type = typename std::conditional<
+                std::is_rvalue_reference<T>::value,
+                decayed&&, decayed&>::type;
+        };
+
         // CONSTEXPR_CHECKS_MAKE_CONSTEXPR(T) expands to a reference of a
-        // constexpr T object. For this to work, T must be a literal type with
-        // a constexpr default constructor.
+        // constexpr T object. For this to work, T must either be a literal
+        // type with a constexpr default constructor, or the closure type of
+        // a capture-less lambda.
 #define CONSTEXPR_CHECKS_MAKE_CONSTEXPR(T)               \
 static_cast<T>(                                          \
     const_cast<typename ::constexpr_checks::detail::     \
@@ -243,10 +298,90 @@ static_cast<T>(                                          \
 
         struct constexpr_template_worm;
 
+        // CONSTEXPR_CHECKS_WORM_BINARY_OPERATORS(X) applies the macro X to
+        // every overloadable binary operator, as X(kind, operator@), where
+        // kind names the operator's counting_worm operation. The operator
+        // comes last, so that X can take it as __VA_ARGS__ even when it
+        // is the comma operator.
+#define CONSTEXPR_CHECKS_WORM_BINARY_OPERATORS(X)                   \
+CONSTEXPR_CHECKS_WORM_NON_ASSIGNING_OPERATORS(X)                    \
+CONSTEXPR_CHECKS_WORM_COMPOUND_ASSIGNMENT_OPERATORS(X)              \
+/**/
+
+#define CONSTEXPR_CHECKS_WORM_NON_ASSIGNING_OPERATORS(X)            \
+X(add, operator+) X(subtract, operator-) X(multiply, operator*)     \
+X(divide, operator/) X(modulo, operator%)                           \
+X(equal, operator==) X(not_equal, operator!=) X(less, operator<)    \
+X(greater, operator>) X(less_equal, operator<=)                     \
+X(greater_equal, operator>=)                                        \
+X(logical_and, operator&&) X(logical_or, operator||)                \
+X(bitwise_and, operator&) X(bitwise_or, operator|)                  \
+X(bitwise_xor, operator^)                                           \
+X(left_shift, operator<<) X(right_shift, operator>>)                \
+X(comma, operator,) X(pointer_to_member, operator->*)               \
+CONSTEXPR_CHECKS_WORM_THREE_WAY_OPERATOR(X)                         \
+/**/
+
+#define CONSTEXPR_CHECKS_WORM_COMPOUND_ASSIGNMENT_OPERATORS(X)      \
+X(add_assign, operator+=) X(subtract_assign, operator-=)            \
+X(multiply_assign, operator*=) X(divide_assign, operator/=)         \
+X(modulo_assign, operator%=) X(and_assign, operator&=)              \
+X(or_assign, operator|=) X(xor_assign, operator^=)                  \
+X(left_shift_assign, operator<<=) X(right_shift_assign, operator>>=) \
+/**/
+
+#ifdef __cpp_impl_three_way_comparison
+#define CONSTEXPR_CHECKS_WORM_THREE_WAY_OPERATOR(X) \
+    X(three_way_compare, operator<=>)
+#else
+#define CONSTEXPR_CHECKS_WORM_THREE_WAY_OPERATOR(X)
+#endif //#ifdef __cpp_impl_three_way_comparison
+
+        // The worm operators are hidden friends, so that they are only
+        // considered when one of the operands is a worm, instead of
+        // joining overload resolution for every operator expression
+        // that reaches this namespace.
+#define CONSTEXPR_CHECKS_TEMPLATE_WORM_BINARY_OPERATOR(kind, ...)   \
+            template<typename T>                                    \
+            friend constexpr inline constexpr_template_worm         \
+            __VA_ARGS__ (constexpr_template_worm, T&&) {            \
+                return {};                                          \
+            }                                                       \
+                                                                    \
+            template<typename T>                                    \
+            friend constexpr inline constexpr_template_worm         \
+            __VA_ARGS__ (T&&, constexpr_template_worm) {            \
+                return {};                                          \
+            }                                                       \
+                                                                    \
+            friend constexpr inline constexpr_template_worm         \
+            __VA_ARGS__ (constexpr_template_worm,                   \
+                constexpr_template_worm) {                          \
+                return {};                                          \
+            }                                                       \
+/**/
+
+#define CONSTEXPR_CHECKS_UNEVALUATED_WORM_BINARY_OPERATOR(kind, ...) \
+            template<typename T>                                    \
+            friend inline template_worm                             \
+            __VA_ARGS__ (template_worm, T&&) { return {}; }         \
+                                                                    \
+            template<typename T>                                    \
+            friend inline template_worm                             \
+            __VA_ARGS__ (T&&, template_worm) { return {}; }         \
+                                                                    \
+            friend inline template_worm                             \
+            __VA_ARGS__ (template_worm, template_worm) { return {}; } \
+/**/
+
         struct constexpr_template_worm {
 
             using type = constexpr_template_worm;
 
+            // Declared for symmetry with template_worm, but never defined:
+            // a non-inline definition here would be emitted into every
+            // translation unit that includes this header and collide at
+            // link time.
             static const constexpr_template_worm value;
 
             template<typename T, int_if_literal<T> = 0>
@@ -282,13 +417,24 @@ static_cast<T>(                                          \
             inline constexpr auto operator&() const { return type{}; }
             inline constexpr auto operator!() const { return type{}; }
             inline constexpr auto operator~() const { return type{}; }
+            inline constexpr auto operator++() const { return type{}; }
+            inline constexpr auto operator--() const { return type{}; }
+            inline constexpr auto operator++(int) const { return type{}; }
+            inline constexpr auto operator--(int) const { return type{}; }
             inline constexpr auto operator()(...) const {
                 return type{};
             }
+
+            template<typename T>
+            inline constexpr auto operator[](T&&) const { return type{}; }
+
+            inline constexpr const constexpr_template_worm*
+            operator->() const { return this; }
+
+            CONSTEXPR_CHECKS_WORM_BINARY_OPERATORS(
+                CONSTEXPR_CHECKS_TEMPLATE_WORM_BINARY_OPERATOR)
         };
 
-        const constexpr_template_worm
-            constexpr_template_worm::value = {};
 
         //template_worm is only used in unevaluated contexts
         struct template_worm : constexpr_template_worm {
@@ -315,47 +461,381 @@ static_cast<T>(                                          \
             template_worm operator&() const;
             template_worm operator!() const;
             template_worm operator~() const;
+            template_worm operator++() const;
+            template_worm operator--() const;
+            template_worm operator++(int) const;
+            template_worm operator--(int) const;
             template_worm operator()(...) const;
+
+            template<typename T>
+            template_worm operator[](T&&) const;
+
+            const template_worm* operator->() const;
+
+            CONSTEXPR_CHECKS_WORM_BINARY_OPERATORS(
+                CONSTEXPR_CHECKS_UNEVALUATED_WORM_BINARY_OPERATOR)
+        };
+
+        // The kinds of operations tallied by counting_worm.
+        enum class operation : unsigned {
+            unary_plus,
+            negate,
+            dereference,
+            address_of,
+            logical_not,
+            complement,
+            call,
+            assign,
+            add,
+            subtract,
+            multiply,
+            divide,
+            modulo,
+            equal,
+            not_equal,
+            less,
+            greater,
+            logical_and,
+            logical_or,
+            bitwise_and,
+            bitwise_or,
+            left_shift,
+            right_shift,
+            comma,
+            less_equal,
+            greater_equal,
+            bitwise_xor,
+            pointer_to_member,
+            three_way_compare,
+            add_assign,
+            subtract_assign,
+            multiply_assign,
+            divide_assign,
+            modulo_assign,
+            and_assign,
+            or_assign,
+            xor_assign,
+            left_shift_assign,
+            right_shift_assign,
+            increment,
+            decrement,
+            subscript,
+            count
         };
 
-#define CONSTEXPR_CHECKS_TEMPLATE_WORM_BINARY_OPERATOR(...) \
-template<typename T>                                        \
-constexpr inline constexpr_template_worm                    \
-__VA_ARGS__ (constexpr_template_worm, T&&) { return {}; }   \
-                                                            \
-template<typename T>                                        \
-constexpr inline constexpr_template_worm                    \
-__VA_ARGS__ (T&&, constexpr_template_worm) { return {}; }   \
-                                                            \
-constexpr inline constexpr_template_worm                    \
-__VA_ARGS__ (constexpr_template_worm,                       \
-    constexpr_template_worm) { return {}; }                 \
-                                                            \
-template_worm __VA_ARGS__ (template_worm, template_worm);   \
-                                                            \
-template<typename T>                                        \
-template_worm __VA_ARGS__ (T&&, template_worm);             \
-                                                            \
-template<typename T>                                        \
-template_worm __VA_ARGS__ (template_worm, T&&);             \
+        struct operation_counts {
+
+            std::size_t by_kind[static_cast<unsigned>(operation::count)];
+
+            // false when the callable could not be probed at compile time,
+            // or when its result was not the probe value carrying the
+            // counts (e.g. when the result was converted to int)
+            bool valid;
+
+            inline constexpr std::size_t
+            operator[](operation op) const {
+                return by_kind[static_cast<unsigned>(op)];
+            }
+
+            inline constexpr std::size_t
+            total() const {
+                std::size_t result = 0;
+                for (std::size_t count : by_kind)
+                    result += count;
+                return result;
+            }
+        };
+
+        // counting_worm is a constexpr_template_worm that counts the
+        // operations applied to it. Counts follow the data flow: the
+        // result of an operation carries the counts of its operands plus
+        // one, so the value returned by a callable carries the counts of
+        // every operation that contributed to it.
+        struct counting_worm {
+
+            operation_counts counts = {};
+
+            template<typename T, int_if_literal<T> = 0>
+            inline constexpr operator T& () const {
+                return CONSTEXPR_CHECKS_MAKE_CONSTEXPR(T&);
+            }
+
+            template<typename T, int_if_literal<T> = 0>
+            inline constexpr operator T && () const {
+                return CONSTEXPR_CHECKS_MAKE_CONSTEXPR(T&&);
+            }
+
+            inline constexpr counting_worm() = default;
+
+            inline constexpr counting_worm(
+                const counting_worm&) = default;
+
+            // a better match than the variadic constructor below, which
+            // would otherwise drop the counts of non-const copies
+            inline constexpr counting_worm(
+                counting_worm&) = default;
+
+            inline constexpr counting_worm(
+                counting_worm&&) = default;
+
+            template<typename... T>
+            inline constexpr counting_worm(T&&...) {}
+
+            static inline constexpr counting_worm
+            tally(operation_counts c, operation op) {
+                counting_worm result{};
+                result.counts = c;
+                ++result.counts.by_kind[static_cast<unsigned>(op)];
+                return result;
+            }
+
+            static inline constexpr counting_worm
+            tally(operation_counts c, operation_counts d, operation op) {
+                for (unsigned i = 0;
+                    i < static_cast<unsigned>(operation::count); ++i)
+                    c.by_kind[i] += d.by_kind[i];
+                return tally(c, op);
+            }
+
+            inline constexpr counting_worm&
+            operator=(counting_worm other) {
+                counts = tally(other.counts, operation::assign).counts;
+                return *this;
+            }
+
+            template<typename T>
+            inline constexpr counting_worm&
+            operator=(T&&) {
+                counts = tally(operation_counts{}, operation::assign).counts;
+                return *this;
+            }
+
+#define CONSTEXPR_CHECKS_COUNTING_WORM_UNARY_OPERATOR(op, kind) \
+            inline constexpr counting_worm op() const {         \
+                return tally(counts, operation::kind);          \
+            }                                                   \
 /**/
 
-        CONSTEXPR_CHECKS_TEMPLATE_WORM_BINARY_OPERATOR(operator+)
-        CONSTEXPR_CHECKS_TEMPLATE_WORM_BINARY_OPERATOR(operator-)
-        CONSTEXPR_CHECKS_TEMPLATE_WORM_BINARY_OPERATOR(operator/)
-        CONSTEXPR_CHECKS_TEMPLATE_WORM_BINARY_OPERATOR(operator*)
-        CONSTEXPR_CHECKS_TEMPLATE_WORM_BINARY_OPERATOR(operator==)
-        CONSTEXPR_CHECKS_TEMPLATE_WORM_BINARY_OPERATOR(operator!=)
-        CONSTEXPR_CHECKS_TEMPLATE_WORM_BINARY_OPERATOR(operator&&)
-        CONSTEXPR_CHECKS_TEMPLATE_WORM_BINARY_OPERATOR(operator||)
-        CONSTEXPR_CHECKS_TEMPLATE_WORM_BINARY_OPERATOR(operator|)
-        CONSTEXPR_CHECKS_TEMPLATE_WORM_BINARY_OPERATOR(operator&)
-        CONSTEXPR_CHECKS_TEMPLATE_WORM_BINARY_OPERATOR(operator%)
-        CONSTEXPR_CHECKS_TEMPLATE_WORM_BINARY_OPERATOR(operator,)
-        CONSTEXPR_CHECKS_TEMPLATE_WORM_BINARY_OPERATOR(operator<<)
-        CONSTEXPR_CHECKS_TEMPLATE_WORM_BINARY_OPERATOR(operator>>)
-        CONSTEXPR_CHECKS_TEMPLATE_WORM_BINARY_OPERATOR(operator<)
-        CONSTEXPR_CHECKS_TEMPLATE_WORM_BINARY_OPERATOR(operator>)
+            CONSTEXPR_CHECKS_COUNTING_WORM_UNARY_OPERATOR(operator+, unary_plus)
+            CONSTEXPR_CHECKS_COUNTING_WORM_UNARY_OPERATOR(operator-, negate)
+            CONSTEXPR_CHECKS_COUNTING_WORM_UNARY_OPERATOR(operator*, dereference)
+            CONSTEXPR_CHECKS_COUNTING_WORM_UNARY_OPERATOR(operator&, address_of)
+            CONSTEXPR_CHECKS_COUNTING_WORM_UNARY_OPERATOR(operator!, logical_not)
+            CONSTEXPR_CHECKS_COUNTING_WORM_UNARY_OPERATOR(operator~, complement)
+
+            inline constexpr counting_worm operator()(...) const {
+                return tally(counts, operation::call);
+            }
+
+            inline constexpr counting_worm& operator++() {
+                counts = tally(counts, operation::increment).counts;
+                return *this;
+            }
+
+            inline constexpr counting_worm& operator--() {
+                counts = tally(counts, operation::decrement).counts;
+                return *this;
+            }
+
+            inline constexpr counting_worm operator++(int) {
+                return ++*this;
+            }
+
+            inline constexpr counting_worm operator--(int) {
+                return --*this;
+            }
+
+            template<typename T>
+            inline constexpr counting_worm operator[](T&&) const {
+                return tally(counts, operation::subscript);
+            }
+
+            inline constexpr counting_worm
+            operator[](counting_worm i) const {
+                return tally(counts, i.counts, operation::subscript);
+            }
+
+#define CONSTEXPR_CHECKS_COUNTING_WORM_BINARY_OPERATOR(kind, ...) \
+            template<typename T>                                    \
+            friend constexpr inline counting_worm                   \
+            __VA_ARGS__ (counting_worm w, T&&) {                    \
+                return tally(w.counts, operation::kind);            \
+            }                                                       \
+                                                                    \
+            template<typename T>                                    \
+            friend constexpr inline counting_worm                   \
+            __VA_ARGS__ (T&&, counting_worm w) {                    \
+                return tally(w.counts, operation::kind);            \
+            }                                                       \
+                                                                    \
+            friend constexpr inline counting_worm                   \
+            __VA_ARGS__ (counting_worm w1, counting_worm w2) {      \
+                return tally(w1.counts, w2.counts, operation::kind); \
+            }                                                       \
+/**/
+
+            CONSTEXPR_CHECKS_WORM_NON_ASSIGNING_OPERATORS(
+                CONSTEXPR_CHECKS_COUNTING_WORM_BINARY_OPERATOR)
+
+            // compound assignments update a worm on the left in place,
+            // like operator=
+#define CONSTEXPR_CHECKS_COUNTING_WORM_COMPOUND_ASSIGNMENT(kind, ...) \
+            template<typename T>                                    \
+            friend constexpr inline counting_worm&                  \
+            __VA_ARGS__ (counting_worm& w, T&&) {                   \
+                w.counts = tally(w.counts, operation::kind).counts; \
+                return w;                                           \
+            }                                                       \
+                                                                    \
+            template<typename T>                                    \
+            friend constexpr inline counting_worm                   \
+            __VA_ARGS__ (T&&, counting_worm w) {                    \
+                return tally(w.counts, operation::kind);            \
+            }                                                       \
+                                                                    \
+            friend constexpr inline counting_worm&                  \
+            __VA_ARGS__ (counting_worm& w1, counting_worm w2) {     \
+                w1.counts = tally(w1.counts, w2.counts,             \
+                    operation::kind).counts;                        \
+                return w1;                                          \
+            }                                                       \
+/**/
+
+            CONSTEXPR_CHECKS_WORM_COMPOUND_ASSIGNMENT_OPERATORS(
+                CONSTEXPR_CHECKS_COUNTING_WORM_COMPOUND_ASSIGNMENT)
+        };
+
+        template<typename T>
+        struct value_worm;
+
+        template<typename T>
+        struct is_value_worm : std::false_type {};
+
+        template<typename T>
+        struct is_value_worm<value_worm<T>> : std::true_type {};
+
+        template<typename T, typename Result>
+        using if_not_value_worm = typename std::enable_if<
+            !is_value_worm<shallow_decay<T>>::value, Result>::type;
+
+        template<typename T>
+        inline constexpr value_worm<T> make_value_worm(T t) {
+            return value_worm<T>{ t };
+        }
+
+        // value_worm<T> is an opt-in probe that carries a concrete value
+        // through every operation, instead of returning a fresh worm like
+        // constexpr_template_worm does. A probe with value_worms is a real
+        // constant evaluation, so division by zero, signed overflow and
+        // out-of-bounds indexing make it fail. Operators are hidden
+        // friends, so that they are only found for value_worms.
+        template<typename T>
+        struct value_worm {
+
+            using type = value_worm;
+            using value_type = T;
+
+            T value;
+
+            inline constexpr operator T() const { return value; }
+
+#define CONSTEXPR_CHECKS_VALUE_WORM_UNARY_OPERATOR(op)              \
+            inline constexpr auto operator op () const {            \
+                return make_value_worm(op value);                   \
+            }                                                       \
+/**/
+
+            CONSTEXPR_CHECKS_VALUE_WORM_UNARY_OPERATOR(+)
+            CONSTEXPR_CHECKS_VALUE_WORM_UNARY_OPERATOR(-)
+            CONSTEXPR_CHECKS_VALUE_WORM_UNARY_OPERATOR(!)
+            CONSTEXPR_CHECKS_VALUE_WORM_UNARY_OPERATOR(~)
+
+            inline constexpr value_worm& operator++() {
+                ++value;
+                return *this;
+            }
+
+            inline constexpr value_worm& operator--() {
+                --value;
+                return *this;
+            }
+
+            inline constexpr value_worm operator++(int) {
+                value_worm result = *this;
+                ++value;
+                return result;
+            }
+
+            inline constexpr value_worm operator--(int) {
+                value_worm result = *this;
+                --value;
+                return result;
+            }
+
+#define CONSTEXPR_CHECKS_VALUE_WORM_BINARY_OPERATOR(op)             \
+            template<typename U>                                    \
+            friend inline constexpr auto                            \
+            operator op (value_worm t, value_worm<U> u) {           \
+                return make_value_worm(t.value op u.value);         \
+            }                                                       \
+                                                                    \
+            template<typename U>                                    \
+            friend inline constexpr auto                            \
+            operator op (value_worm t, U&& u)                       \
+                -> if_not_value_worm<U, value_worm<decltype(        \
+                    t.value op ::std::forward<U>(u))>> {            \
+                return make_value_worm(                             \
+                    t.value op ::std::forward<U>(u));               \
+            }                                                       \
+                                                                    \
+            template<typename U>                                    \
+            friend inline constexpr auto                            \
+            operator op (U&& u, value_worm t)                       \
+                -> if_not_value_worm<U, value_worm<decltype(        \
+                    ::std::forward<U>(u) op t.value)>> {            \
+                return make_value_worm(                             \
+                    ::std::forward<U>(u) op t.value);               \
+            }                                                       \
+/**/
+
+            CONSTEXPR_CHECKS_VALUE_WORM_BINARY_OPERATOR(+)
+            CONSTEXPR_CHECKS_VALUE_WORM_BINARY_OPERATOR(-)
+            CONSTEXPR_CHECKS_VALUE_WORM_BINARY_OPERATOR(*)
+            CONSTEXPR_CHECKS_VALUE_WORM_BINARY_OPERATOR(/)
+            CONSTEXPR_CHECKS_VALUE_WORM_BINARY_OPERATOR(%)
+            CONSTEXPR_CHECKS_VALUE_WORM_BINARY_OPERATOR(&)
+            CONSTEXPR_CHECKS_VALUE_WORM_BINARY_OPERATOR(|)
+            CONSTEXPR_CHECKS_VALUE_WORM_BINARY_OPERATOR(^)
+            CONSTEXPR_CHECKS_VALUE_WORM_BINARY_OPERATOR(<<)
+            CONSTEXPR_CHECKS_VALUE_WORM_BINARY_OPERATOR(>>)
+            CONSTEXPR_CHECKS_VALUE_WORM_BINARY_OPERATOR(==)
+            CONSTEXPR_CHECKS_VALUE_WORM_BINARY_OPERATOR(!=)
+            CONSTEXPR_CHECKS_VALUE_WORM_BINARY_OPERATOR(<)
+            CONSTEXPR_CHECKS_VALUE_WORM_BINARY_OPERATOR(>)
+            CONSTEXPR_CHECKS_VALUE_WORM_BINARY_OPERATOR(<=)
+            CONSTEXPR_CHECKS_VALUE_WORM_BINARY_OPERATOR(>=)
+            CONSTEXPR_CHECKS_VALUE_WORM_BINARY_OPERATOR(&&)
+            CONSTEXPR_CHECKS_VALUE_WORM_BINARY_OPERATOR(||)
+
+#define CONSTEXPR_CHECKS_VALUE_WORM_COMPOUND_ASSIGNMENT(op)         \
+            template<typename U>                                    \
+            inline constexpr value_worm& operator op (U&& u) {      \
+                value op static_cast<T>(::std::forward<U>(u));      \
+                return *this;                                       \
+            }                                                       \
+/**/
+
+            CONSTEXPR_CHECKS_VALUE_WORM_COMPOUND_ASSIGNMENT(+=)
+            CONSTEXPR_CHECKS_VALUE_WORM_COMPOUND_ASSIGNMENT(-=)
+            CONSTEXPR_CHECKS_VALUE_WORM_COMPOUND_ASSIGNMENT(*=)
+            CONSTEXPR_CHECKS_VALUE_WORM_COMPOUND_ASSIGNMENT(/=)
+            CONSTEXPR_CHECKS_VALUE_WORM_COMPOUND_ASSIGNMENT(%=)
+            CONSTEXPR_CHECKS_VALUE_WORM_COMPOUND_ASSIGNMENT(&=)
+            CONSTEXPR_CHECKS_VALUE_WORM_COMPOUND_ASSIGNMENT(|=)
+            CONSTEXPR_CHECKS_VALUE_WORM_COMPOUND_ASSIGNMENT(^=)
+            CONSTEXPR_CHECKS_VALUE_WORM_COMPOUND_ASSIGNMENT(<<=)
+            CONSTEXPR_CHECKS_VALUE_WORM_COMPOUND_ASSIGNMENT(>>=)
+        };
 
             template<typename T, typename... Args>
         struct invoke_info {
@@ -545,6 +1025,97 @@ template_worm __VA_ARGS__ (template_worm, T&&);             \
             using type = std::integral_constant<bool, result::value>;
         };
 
+        // invoke_flags is the result of constexpr_invoke_flags. Every
+        // flag is false when the call is not invokable.
+        struct invoke_flags {
+            bool invokable;
+            bool nothrow_invokable;
+            bool constexpr_invokable;
+            bool literal_result;
+        };
+
+        template<typename Result, bool Nothrow>
+        struct call_result {
+            static constexpr bool invokable = true;
+            static constexpr bool nothrow_invokable = Nothrow;
+            static constexpr bool literal_result =
+                std::is_literal_type<Result>::value;
+        };
+
+        struct no_call_result {
+            static constexpr bool invokable = false;
+            static constexpr bool nothrow_invokable = false;
+            static constexpr bool literal_result = false;
+        };
+
+        // call_info<T, Type>::test<Args...>(0) inspects the call
+        // expression of T with Args once, for all three of invokable,
+        // noexcept and the return type. Type is T with integral_constant
+        // wrappers removed, as in test_invoke_constexpr.
+        template<typename T, typename Type,
+            bool = is_integral_constant<shallow_decay<T>>::value>
+        struct call_info {
+
+            template<typename... Rgs, typename U = T>
+            static auto test(int) -> call_result<
+                decltype(std::declval<U>()(std::declval<Rgs>()...)),
+                noexcept(std::declval<U>()(std::declval<Rgs>()...))>;
+
+            template<typename...>
+            static no_call_result test(...);
+        };
+
+        template<typename T, typename Type>
+        struct call_info<T, Type, true> {
+
+            template<typename... Rgs,
+                typename U = typename std::remove_reference<T>::type>
+            static auto test(int) -> call_result<
+                decltype(U::value(std::declval<Rgs>()...)),
+                noexcept(U::value(std::declval<Rgs>()...))>;
+
+            template<typename...>
+            static no_call_result test(...);
+        };
+
+        template<typename T, typename Member, typename Class>
+        struct call_info<T, Member Class::*, true> {
+
+            template<typename Obj, typename... Rgs,
+                typename U = typename std::remove_reference<T>::type,
+                typename O = make_invokable<Class, Obj&&>>
+            static auto test(int) -> call_result<
+                decltype((std::declval<O>().*U::value)(
+                    std::declval<Rgs>()...)),
+                noexcept((std::declval<O>().*U::value)(
+                    std::declval<Rgs>()...))>;
+
+            template<typename...>
+            static no_call_result test(...);
+        };
+
+        template<typename T, typename... Args>
+        struct invoke_flags_t {
+
+            using info = decltype(call_info<T, typename
+                unwrap_if_integral_constant<T>::type>::template
+                    test<Args...>(0));
+
+            // the same instantiation as is_constexpr_invokable<T, Args...>()
+            using is_constexpr = typename is_constexpr_invokable_impl_types<
+                are_all_constexpr_constructible<T, Args...>::value,
+                T, Args...>::type;
+
+            static inline constexpr invoke_flags value() {
+                return {
+                    info::invokable,
+                    info::nothrow_invokable,
+                    info::invokable && is_constexpr::value,
+                    info::literal_result
+                };
+            }
+        };
+
         template<typename F, typename Seq>
         struct is_constexpr_t;
 
@@ -623,6 +1194,253 @@ template_worm __VA_ARGS__ (template_worm, T&&);             \
             return decltype(is_constexpr_t<type, seq>{}(
                 ::std::forward<T>(t))){};
         }
+
+#ifdef __cpp_nontype_template_parameter_auto
+
+        template<typename>
+        using worm_for = constexpr_template_worm;
+
+        // constant_probe<F> backs is_constexpr<F>() and
+        // is_constexpr_invokable<F, Args...>() for template<auto> arguments.
+        // Function pointers and pointers to member functions are already
+        // constants here, so they are probed directly instead of being
+        // wrapped in (and unwrapped from) an std::integral_constant.
+        template<auto F, typename = decltype(F)>
+        struct constant_probe {
+
+            using constant = std::integral_constant<decltype(F), F>;
+
+            template<typename... Args>
+            using invoke = typename is_constexpr_invokable_impl_types<
+                are_all_constexpr_constructible<constant, Args...>::value,
+                constant, Args...>::type;
+
+            using type = decltype(
+                is_constexpr_impl(constant{}, std::true_type{}));
+        };
+
+        template<auto F, typename... Params>
+        struct function_pointer_probe {
+
+            template<typename... Rgs, typename = typename std::enable_if<
+                are_all_constexpr_constructible<Rgs...>::value>::type,
+                typename = std::integral_constant<bool,
+                    (static_cast<void>(F(
+                        CONSTEXPR_CHECKS_MAKE_CONSTEXPR(Rgs&&)...
+                    )), true)>>
+            static std::true_type test(int);
+
+            template<typename...>
+            static std::false_type test(...);
+
+            template<typename... Args>
+            using invoke = decltype(test<Args...>(0));
+
+            using type = invoke<worm_for<Params>...>;
+        };
+
+        template<auto F, typename Return, typename... Params>
+        struct constant_probe<F, Return(*)(Params...)>
+            : function_pointer_probe<F, Params...> {};
+
+#ifdef __cpp_noexcept_function_type
+
+        template<auto F, typename Return, typename... Params>
+        struct constant_probe<F, Return(*)(Params...) noexcept>
+            : function_pointer_probe<F, Params...> {};
+
+#endif //#ifdef __cpp_noexcept_function_type
+
+        template<auto F, typename Member, typename Class>
+        struct constant_probe<F, Member Class::*> {
+
+            // the same probe as is_constexpr<std::integral_constant<...>>
+            template<typename U, typename... Rgs,
+                typename = typename std::enable_if<
+                    std::is_function<Member>::value
+                    && are_all_constexpr_constructible<
+                        U, Rgs...>::value>::type>
+            static auto test(int) -> decltype(
+                test_invoke_constexpr<Member Class::*>{}(
+                    std::integral_constant<decltype(F), F>{},
+                    std::declval<U>(), std::declval<Rgs>()...));
+
+            template<typename...>
+            static std::false_type test(...);
+
+            template<typename... Args>
+            using invoke = decltype(test<Args...>(0));
+
+            template<typename Seq>
+            struct probe;
+
+            template<std::size_t... I>
+            struct probe<std::index_sequence<I...>> {
+                using type = invoke<
+                    callable_traits::qualified_parent_class_of<
+                        Member Class::*>,
+                    worm_for<std::integral_constant<std::size_t, I>>...>;
+            };
+
+            // arity<T> counts the INVOKE-required object
+            using type = typename std::conditional<
+                std::is_function<Member>::value
+                    && (arity<Member Class::*>::value > 0),
+                probe<std::make_index_sequence<
+                    std::is_function<Member>::value
+                    && (arity<Member Class::*>::value > 0)
+                    ? arity<Member Class::*>::value - 1 : 0>>,
+                type_value<std::false_type, false>
+            >::type::type;
+        };
+
+#endif //#ifdef __cpp_nontype_template_parameter_auto
+
+        template<typename F, bool = is_integral_constant<F>::value>
+        struct probe_target {
+            static inline constexpr F&& get() {
+                return CONSTEXPR_CHECKS_MAKE_CONSTEXPR(F&&);
+            }
+        };
+
+        template<typename F>
+        struct probe_target<F, true> {
+            static inline constexpr auto get() {
+                return F::value;
+            }
+        };
+
+        inline constexpr operation_counts
+        counts_of(counting_worm w) {
+            w.counts.valid = true;
+            return w.counts;
+        }
+
+        template<typename T>
+        inline constexpr operation_counts
+        counts_of(T&&) { return {}; }
+
+        template<typename F, typename Seq>
+        struct count_operations_t;
+
+        template<typename F, std::size_t... I>
+        struct count_operations_t<F, std::index_sequence<I...>> {
+
+            template<typename T, typename = std::integral_constant<bool,
+                (static_cast<void>(probe_target<T>::get()(
+                    counting_worm{ I }...)), true)>>
+            static std::true_type test(int);
+
+            template<typename>
+            static std::false_type test(...);
+
+            static inline constexpr operation_counts
+            count(std::true_type) {
+                return counts_of(probe_target<F>::get()(
+                    counting_worm{ I }...));
+            }
+
+            static inline constexpr operation_counts
+            count(std::false_type) { return {}; }
+
+            static inline constexpr operation_counts
+            count() { return count(decltype(test<F>(0)){}); }
+        };
+
+        template<typename T, typename = std::true_type>
+        struct count_operations_impl {
+            static inline constexpr operation_counts
+            count() { return {}; }
+        };
+
+        template<typename T>
+        struct count_operations_impl<T, typename is_constexpr_constructible<
+            shallow_decay<T>>::type> {
+
+            using type = shallow_decay<T>;
+
+            using min_args = min_arity<
+                typename unwrap_if_integral_constant<type>::type>;
+
+            using seq = std::make_index_sequence<
+                min_args::value < 0 ? 0 : min_args::value>;
+
+            static inline constexpr operation_counts
+            count() { return count_operations_t<type, seq>::count(); }
+        };
+
+        template<typename Seed>
+        using seed_worm = value_worm<shallow_decay<decltype(Seed::value)>>;
+
+        template<typename F, typename... Seeds>
+        struct is_constexpr_seeded_t {
+
+            template<typename T, typename = typename std::enable_if<
+                is_constexpr_constructible<T>::value>::type,
+                typename = std::integral_constant<bool,
+                    (static_cast<void>(probe_target<T>::get()(
+                        seed_worm<Seeds>{ Seeds::value }...)), true)>>
+            static std::true_type test(int);
+
+            template<typename>
+            static std::false_type test(...);
+
+            using type = decltype(test<shallow_decay<F>>(0));
+        };
+
+        // qualify<T, Q> applies the Q-th ref_qualifier to T
+        template<typename T, unsigned Q, typename U = shallow_decay<T>>
+        using qualify = typename std::conditional<Q == 0, U&,
+            typename std::conditional<Q == 1, U&&,
+            typename std::conditional<Q == 2, const U&,
+            const U&&>::type>::type>::type;
+
+        template<typename T, typename... Args>
+        struct qualifier_matrix_t {
+
+            static constexpr const bool is_constructible =
+                are_all_constexpr_constructible<T, Args...>::value;
+
+            // All argument types are qualified the same way, so that
+            // the matrix stays 4x4 (16 instantiations) regardless of
+            // the number of arguments.
+            template<unsigned I>
+            using bit = std::integral_constant<unsigned,
+                is_constexpr_invokable_impl_types<is_constructible,
+                    qualify<T, I / 4>, qualify<Args, I % 4>...
+                >::type::value ? 1u << I : 0u>;
+
+            template<unsigned... I>
+            static constexpr unsigned
+            mask(std::integer_sequence<unsigned, I...>) {
+                unsigned bits[] = { bit<I>::value... };
+                unsigned result = 0;
+                for (unsigned b : bits)
+                    result |= b;
+                return result;
+            }
+
+            using type = std::integral_constant<unsigned,
+                mask(std::make_integer_sequence<unsigned, 16>{})>;
+        };
+    }
+
+    // The cv/ref qualifiers used to index constexpr_qualifier_matrix.
+    enum class ref_qualifier : unsigned {
+        lvalue,
+        rvalue,
+        const_lvalue,
+        const_rvalue
+    };
+
+    // qualifier_bit(object, args) is the bit of a
+    // constexpr_qualifier_matrix mask that is set when a function object
+    // qualified with 'object' is constexpr-invokable with arguments that
+    // are all qualified with 'args'.
+    inline constexpr unsigned
+    qualifier_bit(ref_qualifier object, ref_qualifier args) {
+        return 1u << (static_cast<unsigned>(object) * 4u
+            + static_cast<unsigned>(args));
     }
 
     template<typename T, typename... Args>
@@ -645,6 +1463,24 @@ template_worm __VA_ARGS__ (template_worm, T&&);             \
             are_constexpr_constructible::value, Args...>::type{};
     }
 
+    using detail::invoke_flags;
+
+    // constexpr_invoke_flags<T, Args...>() classifies the call of T with
+    // Args in one query: whether it is invokable, noexcept, constexpr
+    // (as is_constexpr_invokable<T, Args...>()), and whether it returns
+    // a literal type.
+    template<typename T, typename... Args>
+    inline constexpr invoke_flags
+    constexpr_invoke_flags() {
+        return detail::invoke_flags_t<T, Args...>::value();
+    }
+
+    template<typename T, typename... Args>
+    inline constexpr invoke_flags
+    constexpr_invoke_flags(T&&, Args&&...) {
+        return detail::invoke_flags_t<T&&, Args&&...>::value();
+    }
+
     template<typename T>
     inline constexpr auto
     is_constexpr(T&& t) {
@@ -661,6 +1497,114 @@ template_worm __VA_ARGS__ (template_worm, T&&);             \
         return decltype(::constexpr_checks::
             is_constexpr(std::declval<T>())){};
     }
+
+#ifdef __cpp_nontype_template_parameter_auto
+
+    // is_constexpr<&f>() and is_constexpr_invokable<&f, Args...>() take
+    // function pointers and pointers to member functions directly,
+    // without an std::integral_constant wrapper.
+
+    template<auto F, typename... Args>
+    inline constexpr auto
+    is_constexpr_invokable() {
+        return typename detail::constant_probe<F>::
+            template invoke<Args...>{};
+    }
+
+    template<auto F>
+    inline constexpr auto
+    is_constexpr() {
+        return typename detail::constant_probe<F>::type{};
+    }
+
+#endif //#ifdef __cpp_nontype_template_parameter_auto
+
+    using detail::operation;
+    using detail::operation_counts;
+
+    // count_operations<F>() calls F with counting_worm probes during
+    // constant evaluation, and returns the number of operations of each
+    // kind that contributed to the result, as an operation_counts struct.
+    // The counts are a static estimate of the work done by a generic
+    // callable. operation_counts::valid is false when the callable is not
+    // constexpr, or when its result does not carry the counts.
+    template<typename F>
+    inline constexpr operation_counts
+    count_operations() {
+        return detail::count_operations_impl<F>::count();
+    }
+
+    template<typename F>
+    inline constexpr operation_counts
+    count_operations(F&&) {
+        return detail::count_operations_impl<F>::count();
+    }
+
+    // is_constexpr_seeded<F, Seeds...>() calls F with one value-tracking
+    // probe per seed during constant evaluation, where each Seed is a
+    // type with a static constexpr 'value' member, such as an
+    // std::integral_constant. Unlike is_constexpr, the probe computes with
+    // the seed values, so it returns std::false_type when F would divide
+    // by zero, overflow or index out of bounds for them.
+    template<typename F, typename... Seeds>
+    inline constexpr auto
+    is_constexpr_seeded() {
+        return typename detail::is_constexpr_seeded_t<F, Seeds...>::type{};
+    }
+
+    template<typename... Seeds, typename F>
+    inline constexpr auto
+    is_constexpr_seeded(F&&) {
+        return typename detail::is_constexpr_seeded_t<F, Seeds...>::type{};
+    }
+
+#ifdef __cpp_nontype_template_parameter_auto
+
+    template<auto Value>
+    using seed = std::integral_constant<decltype(Value), Value>;
+
+#endif //#ifdef __cpp_nontype_template_parameter_auto
+
+    // constexpr_qualifier_matrix<T, Args...>() checks is_constexpr_invokable
+    // for every ref_qualifier of the function object T crossed with every
+    // ref_qualifier of Args..., and returns the results as an
+    // std::integral_constant<unsigned, Mask>. Use qualifier_bit to read
+    // the mask.
+    template<typename T, typename... Args>
+    inline constexpr auto
+    constexpr_qualifier_matrix() {
+        return typename detail::qualifier_matrix_t<T, Args...>::type{};
+    }
 }
 
+// CONSTEXPR_CHECKS_DEFINE_LIFTED(name, f) defines a function object type
+// 'name' that forwards its arguments to the overload set (or function
+// template) f. The call operator is constexpr, noexcept when the selected
+// overload is, and SFINAE-friendly, so is_constexpr_invokable<name, Args...>
+// checks whichever overload of f is selected for Args. As with any other
+// template, overloads declared after the macro are only found through ADL.
+#define CONSTEXPR_CHECKS_DEFINE_LIFTED(name, ...)                    \
+struct name {                                                        \
+    template<typename... Args>                                       \
+    inline constexpr auto operator()(Args&&... args) const           \
+        noexcept(noexcept(__VA_ARGS__(::std::forward<Args>(args)...))) \
+        -> decltype(__VA_ARGS__(::std::forward<Args>(args)...)) {    \
+        return __VA_ARGS__(::std::forward<Args>(args)...);           \
+    }                                                                \
+}                                                                    \
+/**/
+
+// CONSTEXPR_CHECKS_LIFT(f) is the same function object as a generic
+// capture-less lambda expression, for use inside expressions. Generic
+// lambdas can only be probed where closure types are default
+// constructible (C++20); before that, use CONSTEXPR_CHECKS_DEFINE_LIFTED.
+#define CONSTEXPR_CHECKS_LIFT(...)                                   \
+[](auto&&... args)                                                   \
+    noexcept(noexcept(__VA_ARGS__(                                   \
+        static_cast<decltype(args)&&>(args)...)))                    \
+    -> decltype(__VA_ARGS__(static_cast<decltype(args)&&>(args)...)) { \
+    return __VA_ARGS__(static_cast<decltype(args)&&>(args)...);      \
+}                                                                    \
+/**/
+
 #endif //#ifndef CONSTEXPR_CHECKS_HPP
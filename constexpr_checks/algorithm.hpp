@@ -0,0 +1,286 @@
+/*!
+@file
+
+@copyright Barrett Adair 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+*/
+
+#ifndef CONSTEXPR_CHECKS_ALGORITHM_HPP
+#define CONSTEXPR_CHECKS_ALGORITHM_HPP
+
+#include "constexpr_checks.hpp"
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// Arrays with at least this many elements are processed by several
+// threads at runtime (link with -pthread).
+#ifndef CONSTEXPR_CHECKS_PARALLEL_THRESHOLD
+#define CONSTEXPR_CHECKS_PARALLEL_THRESHOLD (std::size_t{ 1 } << 18)
+#endif
+
+// CONSTEXPR_CHECKS_IS_CONSTANT_EVALUATED() lets constexpr algorithms take
+// the parallel runtime path when they are not constant-evaluated. Without
+// it, constexpr-invokable operations always run sequentially.
+#ifndef CONSTEXPR_CHECKS_IS_CONSTANT_EVALUATED
+#if defined(__cpp_lib_is_constant_evaluated)
+#define CONSTEXPR_CHECKS_IS_CONSTANT_EVALUATED() \
+    ::std::is_constant_evaluated()
+#elif defined(__has_builtin)
+#if __has_builtin(__builtin_is_constant_evaluated)
+#define CONSTEXPR_CHECKS_IS_CONSTANT_EVALUATED() \
+    __builtin_is_constant_evaluated()
+#endif
+#endif
+#endif //#ifndef CONSTEXPR_CHECKS_IS_CONSTANT_EVALUATED
+
+#ifndef CONSTEXPR_CHECKS_IS_CONSTANT_EVALUATED
+#define CONSTEXPR_CHECKS_IS_CONSTANT_EVALUATED() true
+#endif
+
+namespace constexpr_checks {
+
+    namespace detail {
+
+        template<typename F, typename... Args>
+        using is_constexpr_op = decltype(::constexpr_checks::
+            is_constexpr_invokable<F, Args...>());
+
+        // The number of chunks parallel_chunks splits n elements into: one
+        // per hardware thread, but at least 1 (hardware_concurrency() may
+        // return 0) and at most n.
+        inline std::size_t
+        parallel_chunk_count(std::size_t n) {
+            std::size_t chunks = std::thread::hardware_concurrency();
+            return std::max<std::size_t>(1, std::min(chunks, n));
+        }
+
+        // Splits [0, n) into 'chunks' contiguous chunks, as counted by
+        // parallel_chunk_count, and calls f(chunk, begin, end) for each
+        // chunk concurrently. The split only depends on n and the chunk
+        // count, and chunk results are always combined in order, so
+        // associative integer operations give the same results as a
+        // sequential loop.
+        template<typename F>
+        inline void
+        parallel_chunks(std::size_t n, std::size_t chunks, F&& f) {
+
+            std::vector<std::thread> threads;
+            threads.reserve(chunks - 1);
+
+            for (std::size_t c = 1; c < chunks; ++c) {
+                threads.emplace_back([&f, c, chunks, n] {
+                    f(c, n * c / chunks, n * (c + 1) / chunks);
+                });
+            }
+
+            f(0, 0, n / chunks);
+
+            for (std::size_t i = 0; i < threads.size(); ++i)
+                threads[i].join();
+        }
+
+        // The sequential loops below are shared by the compile-time and
+        // runtime paths. They are kept simple, so that the optimizer can
+        // vectorize them.
+
+        template<typename In, typename Out, typename F>
+        inline constexpr void
+        transform_n(const In* in, Out* out, std::size_t n, F& f) {
+            for (std::size_t i = 0; i < n; ++i)
+                out[i] = f(in[i]);
+        }
+
+        template<typename T, typename U, typename Op>
+        inline constexpr U
+        reduce_n(const T* in, std::size_t n, U init, Op& op) {
+            for (std::size_t i = 0; i < n; ++i)
+                init = op(init, in[i]);
+            return init;
+        }
+
+        template<typename T, typename Op>
+        inline constexpr void
+        inclusive_scan_n(const T* in, T* out, std::size_t n, Op& op) {
+            if (n == 0)
+                return;
+            out[0] = in[0];
+            for (std::size_t i = 1; i < n; ++i)
+                out[i] = op(out[i - 1], in[i]);
+        }
+
+        template<typename In, typename Out, typename F>
+        inline void
+        transform_runtime(const In* in, Out* out, std::size_t n, F& f) {
+
+            if (n < CONSTEXPR_CHECKS_PARALLEL_THRESHOLD)
+                return transform_n(in, out, n, f);
+
+            parallel_chunks(n, parallel_chunk_count(n), [&](std::size_t,
+                std::size_t b, std::size_t e) {
+                transform_n(in + b, out + b, e - b, f);
+            });
+        }
+
+        template<typename T, typename U, typename Op>
+        inline U
+        reduce_runtime(const T* in, std::size_t n, U init, Op& op) {
+
+            if (n < CONSTEXPR_CHECKS_PARALLEL_THRESHOLD)
+                return reduce_n(in, n, init, op);
+
+            // every chunk is reduced starting from its first element,
+            // so init is only combined once
+            const std::size_t chunks = parallel_chunk_count(n);
+            std::vector<U> partials(chunks);
+
+            parallel_chunks(n, chunks, [&](std::size_t c,
+                std::size_t b, std::size_t e) {
+                partials[c] = reduce_n(in + b + 1, e - b - 1,
+                    static_cast<U>(in[b]), op);
+            });
+
+            return reduce_n(partials.data(), chunks, init, op);
+        }
+
+        template<typename T, typename Op>
+        inline void
+        inclusive_scan_runtime(const T* in, T* out, std::size_t n, Op& op) {
+
+            if (n < CONSTEXPR_CHECKS_PARALLEL_THRESHOLD)
+                return inclusive_scan_n(in, out, n, op);
+
+            const std::size_t chunks = parallel_chunk_count(n);
+            std::vector<std::size_t> ends(chunks);
+
+            // scan each chunk independently
+            parallel_chunks(n, chunks, [&](std::size_t c,
+                std::size_t b, std::size_t e) {
+                inclusive_scan_n(in + b, out + b, e - b, op);
+                ends[c] = e;
+            });
+
+            // carries[c] is the combined total of every chunk before c
+            std::vector<T> carries(chunks);
+            for (std::size_t c = 1; c < chunks; ++c) {
+                carries[c] = c == 1 ? out[ends[0] - 1]
+                    : op(carries[c - 1], out[ends[c - 1] - 1]);
+            }
+
+            parallel_chunks(n, chunks, [&](std::size_t c, std::size_t b,
+                std::size_t e) {
+                if (c == 0)
+                    return;
+                for (std::size_t i = b; i < e; ++i)
+                    out[i] = op(carries[c], out[i]);
+            });
+        }
+
+        template<typename In, typename Out, typename F>
+        inline void
+        transform_impl(const In* in, Out* out, std::size_t n, F& f,
+            std::false_type) {
+            transform_runtime(in, out, n, f);
+        }
+
+        template<typename In, typename Out, typename F>
+        inline constexpr void
+        transform_impl(const In* in, Out* out, std::size_t n, F& f,
+            std::true_type) {
+            if (CONSTEXPR_CHECKS_IS_CONSTANT_EVALUATED())
+                transform_n(in, out, n, f);
+            else
+                transform_runtime(in, out, n, f);
+        }
+
+        template<typename T, typename U, typename Op>
+        inline U
+        reduce_impl(const T* in, std::size_t n, U init, Op& op,
+            std::false_type) {
+            return reduce_runtime(in, n, init, op);
+        }
+
+        template<typename T, typename U, typename Op>
+        inline constexpr U
+        reduce_impl(const T* in, std::size_t n, U init, Op& op,
+            std::true_type) {
+            return CONSTEXPR_CHECKS_IS_CONSTANT_EVALUATED()
+                ? reduce_n(in, n, init, op)
+                : reduce_runtime(in, n, init, op);
+        }
+
+        template<typename T, typename Op>
+        inline void
+        inclusive_scan_impl(const T* in, T* out, std::size_t n, Op& op,
+            std::false_type) {
+            inclusive_scan_runtime(in, out, n, op);
+        }
+
+        template<typename T, typename Op>
+        inline constexpr void
+        inclusive_scan_impl(const T* in, T* out, std::size_t n, Op& op,
+            std::true_type) {
+            if (CONSTEXPR_CHECKS_IS_CONSTANT_EVALUATED())
+                inclusive_scan_n(in, out, n, op);
+            else
+                inclusive_scan_runtime(in, out, n, op);
+        }
+    }
+
+    // The array algorithms below are constant-evaluable when
+    // is_constexpr_invokable reports that the operation is constexpr for
+    // the element type (writing to an std::array during constant
+    // evaluation requires C++17). At runtime, they use plain loops, and
+    // split arrays of at least CONSTEXPR_CHECKS_PARALLEL_THRESHOLD
+    // elements across threads. Operations passed to constexpr_reduce and
+    // constexpr_inclusive_scan must be associative.
+
+    template<typename T, typename R, std::size_t N, typename F>
+    inline constexpr void
+    constexpr_transform(const std::array<T, N>& in,
+        std::array<R, N>& out, F f) {
+        detail::transform_impl(in.data(), out.data(), N, f,
+            detail::is_constexpr_op<F&, const T&>{});
+    }
+
+    template<typename T, std::size_t N, typename F,
+        typename R = detail::shallow_decay<
+            decltype(std::declval<F&>()(std::declval<const T&>()))>>
+    inline constexpr std::array<R, N>
+    constexpr_transform(const std::array<T, N>& in, F f) {
+        std::array<R, N> out{};
+        constexpr_transform(in, out, f);
+        return out;
+    }
+
+    template<typename T, std::size_t N, typename U, typename Op>
+    inline constexpr U
+    constexpr_reduce(const std::array<T, N>& in, U init, Op op) {
+        return detail::reduce_impl(in.data(), N, init, op,
+            detail::is_constexpr_op<Op&, const U&, const T&>{});
+    }
+
+    template<typename T, std::size_t N, typename Op>
+    inline constexpr void
+    constexpr_inclusive_scan(const std::array<T, N>& in,
+        std::array<T, N>& out, Op op) {
+        detail::inclusive_scan_impl(in.data(), out.data(), N, op,
+            detail::is_constexpr_op<Op&, const T&, const T&>{});
+    }
+
+    template<typename T, std::size_t N, typename Op>
+    inline constexpr std::array<T, N>
+    constexpr_inclusive_scan(const std::array<T, N>& in, Op op) {
+        std::array<T, N> out{};
+        constexpr_inclusive_scan(in, out, op);
+        return out;
+    }
+}
+
+#endif //#ifndef CONSTEXPR_CHECKS_ALGORITHM_HPP
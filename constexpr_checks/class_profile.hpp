@@ -0,0 +1,146 @@
+/*!
+@file
+
+@copyright Barrett Adair 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+*/
+
+#ifndef CONSTEXPR_CHECKS_CLASS_PROFILE_HPP
+#define CONSTEXPR_CHECKS_CLASS_PROFILE_HPP
+
+#include "constexpr_checks.hpp"
+#include <array>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+namespace constexpr_checks {
+
+    // One entry of a constexpr_profile. min_arity does not count the
+    // object, and is -1 for members that are not invokable.
+    struct member_profile {
+        bool invokable;
+        bool constexpr_invokable;
+        int min_arity;
+    };
+
+    namespace detail {
+
+        template<std::size_t>
+        using indexed_worm = constexpr_template_worm;
+
+        // shared_object<T, Obj>() is the make_constexpr object of T,
+        // converted to the qualified_parent_class_of a member. Every
+        // member of a profile is probed with this one object, instead of
+        // one make_constexpr instantiation per member and qualifier.
+        template<typename T, typename Obj>
+        inline constexpr Obj shared_object() {
+            return static_cast<Obj>(
+                const_cast<T&>(make_constexpr<T>::value));
+        }
+
+        template<typename T, typename P,
+            typename = typename std::remove_cv<decltype(P::value)>::type,
+            bool = std::is_member_function_pointer<
+                typename std::remove_cv<decltype(P::value)>::type>::value>
+        struct member_probe {
+            static constexpr member_profile value() {
+                return { false, false, -1 };
+            }
+        };
+
+        template<typename T, typename P, typename Member, typename Class>
+        struct member_probe<T, P, Member Class::*, true> {
+
+            using pmf = Member Class::*;
+
+            using object = callable_traits::qualified_parent_class_of<pmf>;
+
+            // arity<T> counts the INVOKE-required object
+            static constexpr int arg_count = arity<pmf>::value > 0
+                ? arity<pmf>::value - 1 : -1;
+
+            template<typename... Worms>
+            static auto test_invokable(int) -> decltype(
+                static_cast<void>((std::declval<object>().*P::value)(
+                    std::declval<Worms>()...)),
+                std::true_type{});
+
+            template<typename...>
+            static std::false_type test_invokable(...);
+
+            template<typename... Worms, typename U = T,
+                typename = typename std::enable_if<
+                    is_constexpr_constructible<U>::value>::type,
+                typename = std::integral_constant<bool,
+                    (static_cast<void>((shared_object<U, object>().*P::value)(
+                        Worms{}...)), true)>>
+            static std::true_type test_constexpr(int);
+
+            template<typename...>
+            static std::false_type test_constexpr(...);
+
+            template<typename Seq>
+            struct probe;
+
+            template<std::size_t... I>
+            struct probe<std::index_sequence<I...>> {
+
+                static constexpr bool invokable = decltype(test_invokable<
+                    indexed_worm<I>...>(0))::value;
+
+                static constexpr bool constexpr_invokable = invokable
+                    && decltype(test_constexpr<indexed_worm<I>...>(0))::value;
+            };
+
+            template<typename Seq>
+            struct unrelated {
+                static constexpr bool invokable = false;
+                static constexpr bool constexpr_invokable = false;
+            };
+
+            // T must be Class or derived from it
+            using result = typename std::conditional<
+                std::is_base_of<Class, T>::value,
+                probe<std::make_index_sequence<
+                    arg_count < 0 ? 0 : arg_count>>,
+                unrelated<void>>::type;
+
+            static constexpr member_profile value() {
+                return arg_count < 0 || !result::invokable
+                    ? member_profile{ false, false, -1 }
+                    : member_profile{ true, result::constexpr_invokable,
+                        arg_count };
+            }
+        };
+    }
+
+    // constexpr_profile<T, Members...>() classifies a list of pointers to
+    // member functions of T (or of its bases), each wrapped in an
+    // std::integral_constant, and returns an std::array with one
+    // member_profile per member, in order. Pointers to data members are
+    // not invokable.
+    template<typename T, typename... Members>
+    inline constexpr auto
+    constexpr_profile() {
+        return std::array<member_profile, sizeof...(Members)>{{
+            detail::member_probe<T, Members>::value()...
+        }};
+    }
+
+#ifdef __cpp_nontype_template_parameter_auto
+
+    template<typename T, auto Member, auto... Members>
+    inline constexpr auto
+    constexpr_profile() {
+        return constexpr_profile<T,
+            std::integral_constant<decltype(Member), Member>,
+            std::integral_constant<decltype(Members), Members>...>();
+    }
+
+#endif //#ifdef __cpp_nontype_template_parameter_auto
+}
+
+#endif //#ifndef CONSTEXPR_CHECKS_CLASS_PROFILE_HPP
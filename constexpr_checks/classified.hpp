@@ -0,0 +1,50 @@
+/*!
+@file
+
+@copyright Barrett Adair 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+*/
+
+#ifndef CONSTEXPR_CHECKS_CLASSIFIED_HPP
+#define CONSTEXPR_CHECKS_CLASSIFIED_HPP
+
+#include "constexpr_checks.hpp"
+#include <type_traits>
+
+namespace constexpr_checks {
+
+    // The result of is_constexpr_invokable<F, Args...>() as recorded by
+    // tools/classify, which evaluates it in a separate compiler process.
+    // hard_error means that the query does not compile at all, which is
+    // what happens when F is not SFINAE-friendly for Args, e.g. when it
+    // has a deduced return type and its body is ill-formed for them.
+    enum class probe_result {
+        unclassified,
+        constexpr_invokable,
+        not_constexpr_invokable,
+        hard_error
+    };
+
+    // classified<F, Args...>::value is the probe_result of F with Args.
+    // Headers written by tools/classify specialize it for every probe;
+    // every other combination is unclassified.
+    template<typename F, typename... Args>
+    struct classified : std::integral_constant<probe_result,
+        probe_result::unclassified> {};
+
+    // is_classified_constexpr_invokable<F, Args...>() returns
+    // std::true_type only for probes recorded as constexpr_invokable. It
+    // never instantiates F's call operator, so it is safe to use with
+    // callables that are not SFINAE-friendly.
+    template<typename F, typename... Args>
+    inline constexpr auto
+    is_classified_constexpr_invokable() {
+        return std::integral_constant<bool,
+            classified<F, Args...>::value
+                == probe_result::constexpr_invokable>{};
+    }
+}
+
+#endif //#ifndef CONSTEXPR_CHECKS_CLASSIFIED_HPP
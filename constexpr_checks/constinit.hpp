@@ -0,0 +1,110 @@
+/*!
+@file
+
+@copyright Barrett Adair 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+*/
+
+#ifndef CONSTEXPR_CHECKS_CONSTINIT_HPP
+#define CONSTEXPR_CHECKS_CONSTINIT_HPP
+
+#include "constexpr_checks.hpp"
+#include <type_traits>
+#include <utility>
+
+// CONSTEXPR_CHECKS_CONSTINIT is constinit where it is available, and
+// expands to nothing otherwise.
+#ifndef CONSTEXPR_CHECKS_CONSTINIT
+#ifdef __cpp_constinit
+#define CONSTEXPR_CHECKS_CONSTINIT constinit
+#else
+#define CONSTEXPR_CHECKS_CONSTINIT
+#endif //#ifdef __cpp_constinit
+#endif //#ifndef CONSTEXPR_CHECKS_CONSTINIT
+
+namespace constexpr_checks {
+
+    namespace detail {
+
+        // construct<T> is the function object for T{args...}, so that
+        // is_constexpr_invokable can check T's constructors.
+        template<typename T>
+        struct construct {
+
+            template<typename... Args>
+            inline constexpr auto operator()(Args&&... args) const
+                -> decltype(T{ ::std::forward<Args>(args)... }) {
+                return T{ ::std::forward<Args>(args)... };
+            }
+        };
+    }
+
+    // is_constant_initializable<T, Args...>() checks whether T{args...},
+    // with each argument made by make_constexpr, is a constant expression.
+    // A variable of static or thread storage duration with such an
+    // initializer is constant-initialized: it has no dynamic
+    // initialization, so no TLS init wrapper and no guard variable.
+    // Pass std::integral_constant arguments to check specific values.
+    template<typename T, typename... Args>
+    inline constexpr auto
+    is_constant_initializable() {
+        return decltype(::constexpr_checks::is_constexpr_invokable<
+            detail::construct<T>, Args...>()){};
+    }
+
+    // is_guard_free<T, Args...>() additionally requires T to be trivially
+    // destructible. Otherwise, the first access to a function-local static
+    // or a thread_local still registers its destructor, behind a guard or
+    // an init wrapper.
+    template<typename T, typename... Args>
+    inline constexpr auto
+    is_guard_free() {
+        return std::integral_constant<bool,
+            decltype(is_constant_initializable<T, Args...>())::value
+            && std::is_trivially_destructible<T>::value>{};
+    }
+}
+
+// CONSTEXPR_CHECKS_CONSTINIT_VARIABLE(type, name, args...) declares
+// 'type name{args...}' and fails to compile unless the initializer is a
+// constant expression. Put static or thread_local before it, and a
+// semicolon after it, e.g.
+//
+//   thread_local CONSTEXPR_CHECKS_CONSTINIT_VARIABLE(counter, hits, 0);
+//
+// CONSTEXPR_CHECKS_CONSTINIT_DEFAULT(type, name) is the same for
+// 'type name{}', because an empty variadic macro argument is not
+// portable before C++20.
+//
+// Both use constinit where available. Before C++20, they check
+// 'type{args...}' with a static_assert instead, which also requires type
+// to be a literal type.
+#ifdef __cpp_constinit
+
+#define CONSTEXPR_CHECKS_CONSTINIT_VARIABLE(type, name, ...)           \
+constinit type name{ __VA_ARGS__ }                                     \
+/**/
+
+#define CONSTEXPR_CHECKS_CONSTINIT_DEFAULT(type, name)                 \
+constinit type name{}                                                  \
+/**/
+
+#else
+
+#define CONSTEXPR_CHECKS_CONSTINIT_VARIABLE(type, name, ...)           \
+type name{ __VA_ARGS__ };                                              \
+static_assert((static_cast<void>(type{ __VA_ARGS__ }), true),          \
+    "The initializer of " #name " is not a constant expression.")      \
+/**/
+
+#define CONSTEXPR_CHECKS_CONSTINIT_DEFAULT(type, name)                 \
+type name{};                                                           \
+static_assert((static_cast<void>(type{}), true),                       \
+    "The initializer of " #name " is not a constant expression.")      \
+/**/
+
+#endif //#ifdef __cpp_constinit
+
+#endif //#ifndef CONSTEXPR_CHECKS_CONSTINIT_HPP
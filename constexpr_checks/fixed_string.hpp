@@ -0,0 +1,126 @@
+/*!
+@file
+
+@copyright Barrett Adair 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+*/
+
+#ifndef CONSTEXPR_CHECKS_FIXED_STRING_HPP
+#define CONSTEXPR_CHECKS_FIXED_STRING_HPP
+
+#include "constexpr_checks.hpp"
+#include <cstddef>
+#include <string_view>
+#include <type_traits>
+
+// make_constexpr can only value-initialize probe arguments, so a string
+// or array parameter is always probed with an empty value. C++20 allows
+// class types as non-type template parameters, which lets the probe
+// argument carry the real value in its type instead.
+#if defined(__cpp_nontype_template_args) \
+    && __cpp_nontype_template_args >= 201911L
+
+namespace constexpr_checks {
+
+    // fixed_string<N> is a string literal of N - 1 characters that can be
+    // used as a non-type template argument.
+    template<std::size_t N>
+    struct fixed_string {
+
+        char elements[N] = {};
+
+        constexpr fixed_string() = default;
+
+        constexpr fixed_string(const char (&s)[N]) {
+            for (std::size_t i = 0; i < N; ++i)
+                elements[i] = s[i];
+        }
+
+        static constexpr std::size_t size() { return N - 1; }
+
+        constexpr const char* data() const { return elements; }
+        constexpr const char* begin() const { return elements; }
+        constexpr const char* end() const { return elements + size(); }
+
+        constexpr char operator[](std::size_t i) const {
+            return elements[i];
+        }
+
+        constexpr operator std::string_view() const {
+            return { elements, size() };
+        }
+
+        friend constexpr bool
+        operator==(const fixed_string&, const fixed_string&) = default;
+    };
+
+    // fixed_array<T, N> is an array that can be used as a non-type
+    // template argument, e.g. fixed_array{1, 2, 3}.
+    template<typename T, std::size_t N>
+    struct fixed_array {
+
+        T elements[N];
+
+        static constexpr std::size_t size() { return N; }
+
+        constexpr const T* data() const { return elements; }
+        constexpr const T* begin() const { return elements; }
+        constexpr const T* end() const { return elements + N; }
+
+        constexpr const T& operator[](std::size_t i) const {
+            return elements[i];
+        }
+
+        friend constexpr bool
+        operator==(const fixed_array&, const fixed_array&) = default;
+    };
+
+    template<typename T, typename... U>
+    fixed_array(T, U...) -> fixed_array<T, 1 + sizeof...(U)>;
+
+    // literal<V> is an empty, constexpr-constructible probe argument that
+    // converts to V, or to anything V converts to. Passing it to
+    // is_constexpr_invokable and constexpr_fold probes and evaluates with
+    // the real value of V instead of a value-initialized one.
+    template<auto V>
+    struct literal {
+
+        using value_type = decltype(V);
+
+        static constexpr const value_type& value = V;
+
+        constexpr operator const value_type&() const { return V; }
+
+        template<typename T, typename = std::enable_if_t<
+            !std::is_same_v<T, value_type>
+            && std::is_convertible_v<const value_type&, T>>>
+        constexpr operator T() const { return V; }
+    };
+
+    template<fixed_string S>
+    using string_literal = literal<S>;
+
+    // constexpr_fold<F, Args...>() evaluates F with constexpr Args at
+    // compile time, and fails with a static_assert when F is not
+    // constexpr-invokable with them.
+    template<typename F, typename... Args>
+    inline constexpr auto
+    constexpr_fold() {
+
+        static_assert(decltype(
+            is_constexpr_invokable<F, Args...>())::value,
+            "constexpr_fold: F cannot be evaluated at compile time "
+            "with these arguments.");
+
+        constexpr auto result = detail::probe_target<F>::get()(
+            CONSTEXPR_CHECKS_MAKE_CONSTEXPR(Args&&)...);
+
+        return result;
+    }
+}
+
+#endif //#if defined(__cpp_nontype_template_args) && ...
+
+#endif //#ifndef CONSTEXPR_CHECKS_FIXED_STRING_HPP
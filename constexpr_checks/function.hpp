@@ -0,0 +1,341 @@
+/*!
+@file
+
+@copyright Barrett Adair 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+*/
+
+#ifndef CONSTEXPR_CHECKS_FUNCTION_HPP
+#define CONSTEXPR_CHECKS_FUNCTION_HPP
+
+#include "constexpr_checks.hpp"
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#ifndef CONSTEXPR_CHECKS_FUNCTION_CAPACITY
+#define CONSTEXPR_CHECKS_FUNCTION_CAPACITY (3 * sizeof(void*))
+#endif
+
+namespace constexpr_checks {
+
+    template<typename Sig,
+        std::size_t Capacity = CONSTEXPR_CHECKS_FUNCTION_CAPACITY>
+    class constexpr_function;
+
+    template<typename Sig>
+    class constexpr_function_ref;
+
+    namespace detail {
+
+        // How a callable is erased by constexpr_function and
+        // constexpr_function_ref. Only the first three categories can be
+        // used during constant evaluation, because they never need to
+        // cast erased storage back to the callable's type.
+        enum class erasure {
+
+            // std::integral_constant<R(*)(Args...), &f> - the function
+            // is called directly from the invoker
+            constant,
+
+            // empty function objects with a constexpr default
+            // constructor - a fresh object is made in the invoker
+            stateless,
+
+            // function pointers with the exact signature, and capture-less
+            // lambdas converted to them - the pointer is stored as-is
+            pointer,
+
+            // anything else - stored by value in constexpr_function,
+            // referenced in constexpr_function_ref
+            object
+        };
+
+        template<typename T>
+        struct is_function_pointer_constant : std::false_type {};
+
+        template<typename T, T Value>
+        struct is_function_pointer_constant<
+            std::integral_constant<T, Value>>
+            : std::integral_constant<bool, std::is_pointer<T>::value
+                && std::is_function<
+                    typename std::remove_pointer<T>::type>::value> {
+        };
+
+        template<typename F, typename R, typename... Args>
+        using erasure_of = std::integral_constant<erasure,
+            is_function_pointer_constant<F>::value ? erasure::constant
+            : std::is_empty<F>::value
+                && is_default_constexpr_constructible<F>::value
+                ? erasure::stateless
+            : std::is_convertible<F, R(*)(Args...)>::value
+                && (std::is_pointer<F>::value || std::is_empty<F>::value)
+                ? erasure::pointer
+            : erasure::object>;
+
+        template<typename F, typename R, typename... Args>
+        struct is_erasable_as {
+
+            template<typename U, typename Result = decltype(
+                std::declval<const U&>()(std::declval<Args>()...))>
+            static std::integral_constant<bool, std::is_void<R>::value
+                || std::is_convertible<Result, R>::value> test(int);
+
+            template<typename>
+            static std::false_type test(...);
+
+            static constexpr const bool value =
+                decltype(test<F>(0))::value;
+        };
+
+        template<typename Storage, typename R, typename... Args>
+        struct erased_invoker {
+
+            using type = R(*)(const Storage&, Args...);
+
+            template<typename F>
+            static constexpr R
+            constant(const Storage&, Args... args) {
+                return static_cast<R>(
+                    F::value(::std::forward<Args>(args)...));
+            }
+
+            template<typename F>
+            static constexpr R
+            stateless(const Storage&, Args... args) {
+                return static_cast<R>(
+                    F{}(::std::forward<Args>(args)...));
+            }
+
+            static constexpr R
+            pointer(const Storage& s, Args... args) {
+                return s.function(::std::forward<Args>(args)...);
+            }
+
+            template<typename F>
+            static R
+            object(const Storage& s, Args... args) {
+                return static_cast<R>((*s.template get<F>())(
+                    ::std::forward<Args>(args)...));
+            }
+        };
+
+        template<std::size_t Capacity, typename R, typename... Args>
+        union function_storage {
+
+            R(*function)(Args...);
+
+            alignas(std::max_align_t) unsigned char bytes[Capacity];
+
+            inline constexpr function_storage() : function(nullptr) {}
+
+            inline constexpr function_storage(R(*f)(Args...))
+                : function(f) {}
+
+            template<typename F>
+            inline const F* get() const {
+                return reinterpret_cast<const F*>(bytes);
+            }
+        };
+
+        template<typename R, typename... Args>
+        union function_ref_storage {
+
+            R(*function)(Args...);
+
+            const void* object;
+
+            inline constexpr function_ref_storage() : function(nullptr) {}
+
+            inline constexpr function_ref_storage(R(*f)(Args...))
+                : function(f) {}
+
+            inline constexpr function_ref_storage(const void* o)
+                : object(o) {}
+
+            template<typename F>
+            inline const F* get() const {
+                return static_cast<const F*>(object);
+            }
+        };
+    }
+
+    // constexpr_function<R(Args...), Capacity> is a type-erased callable
+    // wrapper with an inline buffer of Capacity bytes. It never
+    // allocates, and has no virtual functions - a call is one indirect
+    // call through a plain function pointer. Like callables stored by
+    // std::integral_constant or as empty function objects, capture-less
+    // lambdas and function pointers can be stored and called during
+    // constant evaluation, so constexpr_function::is_constexpr_target<F>
+    // mirrors is_constexpr_invokable for F. Other function objects must
+    // be trivially copyable, and are stored in (and called from) the
+    // buffer at runtime only.
+    template<typename R, typename... Args, std::size_t Capacity>
+    class constexpr_function<R(Args...), Capacity> {
+
+        using storage = detail::function_storage<Capacity, R, Args...>;
+        using invoker = detail::erased_invoker<storage, R, Args...>;
+
+        template<typename F>
+        using erasure_of = detail::erasure_of<F, R, Args...>;
+
+        // function objects stored in the buffer must be trivially
+        // copyable, since the buffer is copied as bytes
+        template<typename F>
+        using if_erasable = typename std::enable_if<
+            !std::is_same<F, constexpr_function>::value
+            && detail::is_erasable_as<F, R, Args...>::value
+            && (erasure_of<F>::value != detail::erasure::object
+                || std::is_trivially_copyable<F>::value),
+            int>::type;
+
+    public:
+
+        // std::true_type when a constexpr_function holding an F can be
+        // constructed and called during constant evaluation
+        template<typename F, typename U = typename std::decay<F>::type>
+        using is_constexpr_target = std::integral_constant<bool,
+            erasure_of<U>::value != detail::erasure::object
+            && decltype(::constexpr_checks::
+                is_constexpr_invokable<U, Args...>())::value>;
+
+        inline constexpr constexpr_function() = default;
+
+        inline constexpr constexpr_function(R(*f)(Args...))
+            : storage_(f), invoke_(f ? &invoker::pointer : nullptr) {}
+
+        template<typename F, typename U = typename std::decay<F>::type,
+            if_erasable<U> = 0>
+        inline constexpr constexpr_function(F&& f)
+            : constexpr_function(::std::forward<F>(f), erasure_of<U>{}) {}
+
+        inline constexpr explicit operator bool() const {
+            return invoke_ != nullptr;
+        }
+
+        // Calling an empty constexpr_function is undefined behavior.
+        // Stored function pointers are called directly rather than
+        // through the invoker, so that they don't pay for two indirect
+        // calls.
+        inline constexpr R operator()(Args... args) const {
+            return invoke_ == &invoker::pointer
+                ? storage_.function(::std::forward<Args>(args)...)
+                : invoke_(storage_, ::std::forward<Args>(args)...);
+        }
+
+    private:
+
+        template<typename F, typename U = typename std::decay<F>::type>
+        inline constexpr constexpr_function(F&&, std::integral_constant<
+            detail::erasure, detail::erasure::constant>)
+            : invoke_(&invoker::template constant<U>) {}
+
+        template<typename F, typename U = typename std::decay<F>::type>
+        inline constexpr constexpr_function(F&&, std::integral_constant<
+            detail::erasure, detail::erasure::stateless>)
+            : invoke_(&invoker::template stateless<U>) {}
+
+        template<typename F>
+        inline constexpr constexpr_function(F&& f, std::integral_constant<
+            detail::erasure, detail::erasure::pointer>)
+            : constexpr_function(static_cast<R(*)(Args...)>(f)) {}
+
+        template<typename F, typename U = typename std::decay<F>::type>
+        inline constexpr_function(F&& f, std::integral_constant<
+            detail::erasure, detail::erasure::object>)
+            : invoke_(&invoker::template object<U>) {
+
+            static_assert(sizeof(U) <= Capacity,
+                "This function object does not fit in the buffer of "
+                "this constexpr_function. Increase the Capacity "
+                "template argument.");
+
+            static_assert(alignof(U) <= alignof(std::max_align_t),
+                "constexpr_function cannot store over-aligned "
+                "function objects.");
+
+            ::new (static_cast<void*>(storage_.bytes))
+                U(::std::forward<F>(f));
+        }
+
+        storage storage_ = {};
+        typename invoker::type invoke_ = nullptr;
+    };
+
+    // constexpr_function_ref<R(Args...)> is the non-owning counterpart of
+    // constexpr_function. It refers to function objects instead of
+    // copying them, so it has no size or copyability requirements, and
+    // must not outlive the function object it refers to.
+    template<typename R, typename... Args>
+    class constexpr_function_ref<R(Args...)> {
+
+        using storage = detail::function_ref_storage<R, Args...>;
+        using invoker = detail::erased_invoker<storage, R, Args...>;
+
+        template<typename F>
+        using erasure_of = detail::erasure_of<F, R, Args...>;
+
+        template<typename F>
+        using if_erasable = typename std::enable_if<
+            !std::is_same<F, constexpr_function_ref>::value
+            && detail::is_erasable_as<F, R, Args...>::value,
+            int>::type;
+
+    public:
+
+        template<typename F, typename U = typename std::decay<F>::type>
+        using is_constexpr_target = std::integral_constant<bool,
+            erasure_of<U>::value != detail::erasure::object
+            && decltype(::constexpr_checks::
+                is_constexpr_invokable<U, Args...>())::value>;
+
+        inline constexpr constexpr_function_ref(R(*f)(Args...))
+            : storage_(f), invoke_(&invoker::pointer) {}
+
+        template<typename F, typename U = typename std::decay<F>::type,
+            if_erasable<U> = 0>
+        inline constexpr constexpr_function_ref(F&& f)
+            : constexpr_function_ref(f, erasure_of<U>{}) {}
+
+        inline constexpr R operator()(Args... args) const {
+            return invoke_ == &invoker::pointer
+                ? storage_.function(::std::forward<Args>(args)...)
+                : invoke_(storage_, ::std::forward<Args>(args)...);
+        }
+
+    private:
+
+        template<typename U>
+        inline constexpr constexpr_function_ref(U&, std::integral_constant<
+            detail::erasure, detail::erasure::constant>)
+            : invoke_(&invoker::template constant<
+                typename std::remove_const<U>::type>) {}
+
+        template<typename U>
+        inline constexpr constexpr_function_ref(U&, std::integral_constant<
+            detail::erasure, detail::erasure::stateless>)
+            : invoke_(&invoker::template stateless<
+                typename std::remove_const<U>::type>) {}
+
+        template<typename U>
+        inline constexpr constexpr_function_ref(U& f, std::integral_constant<
+            detail::erasure, detail::erasure::pointer>)
+            : constexpr_function_ref(static_cast<R(*)(Args...)>(f)) {}
+
+        template<typename U>
+        inline constexpr constexpr_function_ref(U& f, std::integral_constant<
+            detail::erasure, detail::erasure::object>)
+            : storage_(static_cast<const void*>(std::addressof(f))),
+            invoke_(&invoker::template object<
+                typename std::remove_const<U>::type>) {}
+
+        storage storage_;
+        typename invoker::type invoke_;
+    };
+}
+
+#endif //#ifndef CONSTEXPR_CHECKS_FUNCTION_HPP
@@ -0,0 +1,181 @@
+/*!
+@file
+
+@copyright Barrett Adair 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+*/
+
+#ifndef CONSTEXPR_CHECKS_PIPELINE_HPP
+#define CONSTEXPR_CHECKS_PIPELINE_HPP
+
+#include "constexpr_checks.hpp"
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace constexpr_checks {
+
+    template<typename... Stages>
+    class pipeline;
+
+    namespace detail {
+
+        // A value of a stateless type carries no runtime information, so
+        // any two objects of the type behave the same, and the one made by
+        // make_constexpr can stand in for the real one.
+        template<typename T, typename U = shallow_decay<T>>
+        using is_stateless = std::integral_constant<bool,
+            std::is_empty<U>::value
+            && is_constexpr_constructible<U>::value>;
+
+        // pipeline_fold<In, std::tuple<Stages...>, K>::value() applies the
+        // first K stages to the constexpr In object.
+        template<typename In, typename Stages, std::size_t K>
+        struct pipeline_fold {
+
+            using stage = typename std::tuple_element<K - 1, Stages>::type;
+
+            static inline constexpr auto value() {
+                return CONSTEXPR_CHECKS_MAKE_CONSTEXPR(const stage&)(
+                    pipeline_fold<In, Stages, K - 1>::value());
+            }
+        };
+
+        template<typename In, typename Stages>
+        struct pipeline_fold<In, Stages, 0> {
+            static inline constexpr shallow_decay<In> value() {
+                return CONSTEXPR_CHECKS_MAKE_CONSTEXPR(In);
+            }
+        };
+
+        template<typename In, typename Stages, std::size_t K>
+        constexpr auto pipeline_constant =
+            pipeline_fold<In, Stages, K>::value();
+
+        // pipeline_prefix<In, std::tuple<Stages...>, K>::value is the
+        // length of the longest constexpr prefix of the pipeline, given
+        // that its first K stages are already known to fold.
+        template<typename In, typename Stages, std::size_t K,
+            bool = (K < std::tuple_size<Stages>::value)>
+        struct pipeline_prefix {
+
+            using stage = typename std::tuple_element<K, Stages>::type;
+
+            template<typename S, typename = typename std::enable_if<
+                is_stateless<S>::value>::type,
+                typename = std::integral_constant<bool, (static_cast<void>(
+                    CONSTEXPR_CHECKS_MAKE_CONSTEXPR(const S&)(
+                        pipeline_fold<In, Stages, K>::value())), true)>>
+            static pipeline_prefix<In, Stages, K + 1> test(int);
+
+            template<typename>
+            static std::integral_constant<std::size_t, K> test(...);
+
+            static constexpr const std::size_t value =
+                decltype(test<stage>(0))::value;
+        };
+
+        template<typename In, typename Stages, std::size_t K>
+        struct pipeline_prefix<In, Stages, K, false> {
+            static constexpr const std::size_t value = K;
+        };
+
+        template<typename In, typename Stages>
+        using folded_stages = std::integral_constant<std::size_t,
+            is_stateless<In>::value
+                ? pipeline_prefix<In, Stages, 0>::value : 0>;
+    }
+
+    // pipeline<Stages...> calls each stage with the result of the previous
+    // one. For an input whose type is stateless (e.g. an
+    // std::integral_constant), the longest prefix of stateless stages
+    // that is constexpr-invokable is folded into a compile-time constant,
+    // and only the remaining stages are called at runtime.
+    // folded_stages<In>() tells how many stages are folded for input In.
+    template<typename... Stages>
+    class pipeline {
+
+        using stages_type = std::tuple<Stages...>;
+
+        template<typename In>
+        using folded = detail::folded_stages<In, stages_type>;
+
+        template<std::size_t I>
+        using is_last = std::integral_constant<bool,
+            I == sizeof...(Stages)>;
+
+    public:
+
+        inline constexpr explicit pipeline(Stages... stages)
+            : stages_(::std::move(stages)...) {}
+
+        template<typename In>
+        static inline constexpr auto
+        folded_stages() {
+            return folded<In>{};
+        }
+
+        template<typename In>
+        inline constexpr decltype(auto)
+        operator()(In&& in) const {
+            return run(::std::forward<In>(in), folded<In>{});
+        }
+
+        template<typename F>
+        inline constexpr auto
+        operator|(F&& f) const {
+            return append(::std::forward<F>(f),
+                std::index_sequence_for<Stages...>{});
+        }
+
+    private:
+
+        template<typename In>
+        inline constexpr decltype(auto)
+        run(In&& in, std::integral_constant<std::size_t, 0>) const {
+            return apply<0>(::std::forward<In>(in), is_last<0>{});
+        }
+
+        template<typename In, std::size_t K>
+        inline constexpr decltype(auto)
+        run(In&&, std::integral_constant<std::size_t, K>) const {
+            return apply<K>(detail::pipeline_constant<
+                In, stages_type, K>, is_last<K>{});
+        }
+
+        template<std::size_t I, typename T>
+        inline constexpr decltype(auto)
+        apply(T&& t, std::false_type) const {
+            return apply<I + 1>(std::get<I>(stages_)(
+                ::std::forward<T>(t)), is_last<I + 1>{});
+        }
+
+        template<std::size_t I, typename T>
+        inline constexpr detail::shallow_decay<T>
+        apply(T&& t, std::true_type) const {
+            return ::std::forward<T>(t);
+        }
+
+        template<typename F, std::size_t... I>
+        inline constexpr auto
+        append(F&& f, std::index_sequence<I...>) const {
+            return pipeline<Stages..., typename std::decay<F>::type>(
+                std::get<I>(stages_)..., ::std::forward<F>(f));
+        }
+
+        stages_type stages_;
+    };
+
+    // pipe(f, g, h)(x) is h(g(f(x))). pipe(f) | g | h is the same.
+    template<typename... F>
+    inline constexpr auto
+    pipe(F&&... f) {
+        return pipeline<typename std::decay<F>::type...>(
+            ::std::forward<F>(f)...);
+    }
+}
+
+#endif //#ifndef CONSTEXPR_CHECKS_PIPELINE_HPP
@@ -0,0 +1,250 @@
+/*!
+@file
+
+@copyright Barrett Adair 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+*/
+
+#ifndef CONSTEXPR_CHECKS_SORTED_INDEX_HPP
+#define CONSTEXPR_CHECKS_SORTED_INDEX_HPP
+
+#include "constexpr_checks.hpp"
+#include <array>
+#include <cstddef>
+#include <functional>
+#include <type_traits>
+#include <utility>
+
+namespace constexpr_checks {
+
+    namespace detail {
+
+        // std::swap is not constexpr before C++20
+        template<typename T>
+        inline constexpr void
+        constexpr_swap(T& a, T& b) {
+            T tmp = a;
+            a = b;
+            b = tmp;
+        }
+
+        template<typename T, typename Compare>
+        inline constexpr void
+        sift_down(T* a, std::size_t root, std::size_t n,
+            const Compare& comp) {
+
+            while (2 * root + 1 < n) {
+                std::size_t child = 2 * root + 1;
+                if (child + 1 < n && comp(a[child], a[child + 1]))
+                    ++child;
+                if (!comp(a[root], a[child]))
+                    return;
+                constexpr_swap(a[root], a[child]);
+                root = child;
+            }
+        }
+
+        // heap sort, because it needs neither recursion nor extra storage
+        // during constant evaluation
+        template<typename T, typename Compare>
+        inline constexpr void
+        heap_sort(T* a, std::size_t n, const Compare& comp) {
+
+            for (std::size_t i = n / 2; i-- > 0;)
+                sift_down(a, i, n, comp);
+
+            for (std::size_t end = n; end-- > 1;) {
+                constexpr_swap(a[0], a[end]);
+                sift_down(a, 0, end, comp);
+            }
+        }
+
+        // Copies sorted[i...] to the subtree of node k (1-based) of the
+        // Eytzinger layout in order, and returns the next i.
+        template<typename T>
+        inline constexpr std::size_t
+        eytzinger_fill(const T* sorted, T* out, std::size_t n,
+            std::size_t i, std::size_t k) {
+
+            if (k <= n) {
+                i = eytzinger_fill(sorted, out, n, i, 2 * k);
+                out[k - 1] = sorted[i++];
+                i = eytzinger_fill(sorted, out, n, i, 2 * k + 1);
+            }
+
+            return i;
+        }
+
+        inline constexpr std::size_t
+        trailing_ones(std::size_t k) {
+#if defined(__GNUC__)
+            return static_cast<std::size_t>(
+                __builtin_ctzll(~static_cast<unsigned long long>(k)));
+#else
+            std::size_t result = 0;
+            while (k & 1) {
+                k >>= 1;
+                ++result;
+            }
+            return result;
+#endif
+        }
+
+        template<typename T, std::size_t N>
+        struct key_buffer {
+            T elements[N];
+        };
+    }
+
+    // eytzinger_index<T, N, Compare> holds N keys sorted by Compare, in
+    // Eytzinger (breadth-first) order: the children of the key at node k
+    // are at nodes 2k and 2k + 1. A lower_bound descends the implicit
+    // tree without a data-dependent branch, and the next levels of the
+    // tree are adjacent in memory, which suits the hardware prefetcher.
+    // The constructor is constexpr, so the layout can be built at compile
+    // time when Compare is constexpr-invokable.
+    template<typename T, std::size_t N, typename Compare = std::less<>>
+    class eytzinger_index {
+
+        static_assert(N > 0, "eytzinger_index needs at least one key.");
+
+    public:
+
+        using value_type = T;
+        using key_compare = Compare;
+
+        template<typename Keys>
+        constexpr eytzinger_index(const Keys& keys, Compare comp = Compare{})
+            : elements_{}, comp_(comp) {
+
+            detail::key_buffer<T, N> sorted{};
+
+            for (std::size_t i = 0; i < N; ++i)
+                sorted.elements[i] = keys[i];
+
+            detail::heap_sort(sorted.elements, N, comp_);
+            detail::eytzinger_fill(sorted.elements, elements_, N, 0, 1);
+        }
+
+        static constexpr std::size_t size() { return N; }
+
+        // the keys, in Eytzinger order
+        constexpr const T* begin() const { return elements_; }
+        constexpr const T* end() const { return elements_ + N; }
+
+        constexpr const T& operator[](std::size_t i) const {
+            return elements_[i];
+        }
+
+        // lower_bound(key) returns the position in Eytzinger order of the
+        // first key that is not less than key, or size() if there is none.
+        template<typename K>
+        constexpr std::size_t lower_bound(const K& key) const {
+
+            std::size_t k = 1;
+
+            while (k <= N)
+                k = 2 * k + static_cast<std::size_t>(
+                    comp_(elements_[k - 1], key));
+
+            // undo the right turns after the last left turn, and that
+            // left turn itself
+            k >>= detail::trailing_ones(k) + 1;
+
+            return k == 0 ? N : k - 1;
+        }
+
+        template<typename K>
+        constexpr const T* find(const K& key) const {
+            std::size_t i = lower_bound(key);
+            return i != N && !comp_(key, elements_[i])
+                ? elements_ + i : end();
+        }
+
+        template<typename K>
+        constexpr bool contains(const K& key) const {
+            return find(key) != end();
+        }
+
+    private:
+
+        T elements_[N];
+        Compare comp_;
+    };
+
+    template<typename T, std::size_t N, typename Compare = std::less<>>
+    inline constexpr eytzinger_index<T, N, Compare>
+    make_sorted_index(const T (&keys)[N], Compare comp = Compare{}) {
+        return { keys, comp };
+    }
+
+    template<typename T, std::size_t N, typename Compare = std::less<>>
+    inline constexpr eytzinger_index<T, N, Compare>
+    make_sorted_index(const std::array<T, N>& keys,
+        Compare comp = Compare{}) {
+        return { keys, comp };
+    }
+
+    namespace detail {
+
+        template<typename Keys, typename Compare>
+        struct sorted_index_types {
+
+            using keys_type = shallow_decay<decltype(
+                CONSTEXPR_CHECKS_MAKE_CONSTEXPR(Keys&&)())>;
+
+            using value_type = shallow_decay<decltype(
+                std::declval<const keys_type&>()[0])>;
+
+            using type = eytzinger_index<value_type,
+                std::tuple_size<keys_type>::value, Compare>;
+
+            using is_constexpr = decltype(::constexpr_checks::
+                is_constexpr_invokable<Compare, value_type, value_type>());
+        };
+
+        template<typename Keys, typename Compare,
+            bool = sorted_index_types<Keys, Compare>::is_constexpr::value>
+        struct static_sorted_index_impl {
+
+            using type = typename sorted_index_types<Keys, Compare>::type;
+
+            static constexpr type value = type{
+                CONSTEXPR_CHECKS_MAKE_CONSTEXPR(Keys&&)(), Compare{} };
+
+            static inline const type& get() { return value; }
+        };
+
+        template<typename Keys, typename Compare, bool B>
+        constexpr typename static_sorted_index_impl<Keys, Compare, B>::type
+        static_sorted_index_impl<Keys, Compare, B>::value;
+
+        template<typename Keys, typename Compare>
+        struct static_sorted_index_impl<Keys, Compare, false> {
+
+            using type = typename sorted_index_types<Keys, Compare>::type;
+
+            static inline const type& get() {
+                static const type value{ Keys{}(), Compare{} };
+                return value;
+            }
+        };
+    }
+
+    // static_sorted_index<Keys, Compare>::get() returns the one
+    // eytzinger_index of the std::array returned by the stateless builder
+    // Keys. When Compare is constexpr-invokable with two keys, the index
+    // is sorted at compile time and emitted as constant data. Otherwise,
+    // it is sorted once, on first use.
+    template<typename Keys, typename Compare = std::less<>>
+    struct static_sorted_index
+        : detail::static_sorted_index_impl<Keys, Compare> {
+
+        using is_constexpr = typename detail::sorted_index_types<
+            Keys, Compare>::is_constexpr;
+    };
+}
+
+#endif //#ifndef CONSTEXPR_CHECKS_SORTED_INDEX_HPP
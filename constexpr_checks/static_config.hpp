@@ -0,0 +1,159 @@
+/*!
+@file
+
+@copyright Barrett Adair 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+*/
+
+#ifndef CONSTEXPR_CHECKS_STATIC_CONFIG_HPP
+#define CONSTEXPR_CHECKS_STATIC_CONFIG_HPP
+
+#include "constexpr_checks.hpp"
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+namespace constexpr_checks {
+
+    // text is a constexpr view of an embedded configuration blob, such
+    // as a raw string literal or a char array initialized with #embed.
+    // A trailing '\0' from a string literal is not part of the text.
+    class text {
+
+        const char* first_;
+        std::size_t size_;
+
+    public:
+
+        static constexpr std::size_t npos = static_cast<std::size_t>(-1);
+
+        inline constexpr text() : first_(nullptr), size_(0) {}
+
+        inline constexpr text(const char* first, std::size_t size)
+            : first_(first), size_(size) {}
+
+        template<std::size_t N>
+        inline constexpr text(const char (&s)[N])
+            : first_(s), size_(N != 0 && s[N - 1] == '\0' ? N - 1 : N) {}
+
+        inline constexpr const char* data() const { return first_; }
+        inline constexpr std::size_t size() const { return size_; }
+        inline constexpr bool empty() const { return size_ == 0; }
+        inline constexpr const char* begin() const { return first_; }
+        inline constexpr const char* end() const { return first_ + size_; }
+
+        inline constexpr char operator[](std::size_t i) const {
+            return first_[i];
+        }
+
+        // clamped like std::string_view::substr, but never throws
+        inline constexpr text
+        substr(std::size_t pos, std::size_t count = npos) const {
+            return pos >= size_ ? text{ first_ + size_, 0 }
+                : text{ first_ + pos,
+                    count < size_ - pos ? count : size_ - pos };
+        }
+
+        inline constexpr std::size_t
+        find(char c, std::size_t pos = 0) const {
+            for (; pos < size_; ++pos) {
+                if (first_[pos] == c)
+                    return pos;
+            }
+            return npos;
+        }
+
+        friend inline constexpr bool operator==(text a, text b) {
+            if (a.size_ != b.size_)
+                return false;
+            for (std::size_t i = 0; i < a.size_; ++i) {
+                if (a.first_[i] != b.first_[i])
+                    return false;
+            }
+            return true;
+        }
+
+        friend inline constexpr bool operator!=(text a, text b) {
+            return !(a == b);
+        }
+    };
+
+    namespace detail {
+
+        template<typename Text, typename Parser>
+        struct static_config_types {
+
+            using text_type = shallow_decay<decltype(
+                CONSTEXPR_CHECKS_MAKE_CONSTEXPR(Text&&)())>;
+
+            using type = shallow_decay<decltype(std::declval<Parser>()(
+                std::declval<const text_type&>()))>;
+
+            // Parses the real text, not a placeholder, so a parser that
+            // rejects some other input is still constexpr for this one
+            template<typename T, typename P, typename = typename
+                std::enable_if<are_all_constexpr_constructible<
+                    T, P>::value>::type,
+                typename = std::integral_constant<bool,
+                    (static_cast<void>(CONSTEXPR_CHECKS_MAKE_CONSTEXPR(P&&)(
+                        CONSTEXPR_CHECKS_MAKE_CONSTEXPR(T&&)()
+                    )), true)>>
+            static std::true_type test(int);
+
+            template<typename, typename>
+            static std::false_type test(...);
+
+            // a non-literal result could not be stored in a constexpr
+            // variable even if the parse itself is constexpr
+            using is_constexpr = std::integral_constant<bool,
+                decltype(test<Text, Parser>(0))::value
+                && std::is_literal_type<type>::value>;
+        };
+
+        template<typename Text, typename Parser,
+            bool = static_config_types<Text, Parser>::is_constexpr::value>
+        struct static_config_impl {
+
+            using type = typename static_config_types<Text, Parser>::type;
+
+            static constexpr type value =
+                CONSTEXPR_CHECKS_MAKE_CONSTEXPR(Parser&&)(
+                    CONSTEXPR_CHECKS_MAKE_CONSTEXPR(Text&&)());
+
+            static inline const type& get() { return value; }
+        };
+
+        template<typename Text, typename Parser, bool B>
+        constexpr typename static_config_impl<Text, Parser, B>::type
+        static_config_impl<Text, Parser, B>::value;
+
+        template<typename Text, typename Parser>
+        struct static_config_impl<Text, Parser, false> {
+
+            using type = typename static_config_types<Text, Parser>::type;
+
+            static inline const type& get() {
+                static const type value = Parser{}(Text{}());
+                return value;
+            }
+        };
+    }
+
+    // static_config<Text, Parser>::get() returns the one result of
+    // calling the stateless Parser with the text returned by the
+    // stateless builder Text. When that call is a constant expression and
+    // returns a literal type, the text is parsed at compile time into
+    // constant data. Otherwise, it is parsed once, on first use - which
+    // includes a constexpr parser that rejects the text, so such a config
+    // fails at startup rather than at compile time.
+    template<typename Text, typename Parser>
+    struct static_config : detail::static_config_impl<Text, Parser> {
+
+        using is_constexpr = typename detail::static_config_types<
+            Text, Parser>::is_constexpr;
+    };
+}
+
+#endif //#ifndef CONSTEXPR_CHECKS_STATIC_CONFIG_HPP
@@ -0,0 +1,169 @@
+/*!
+@file
+
+@copyright Barrett Adair 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+*/
+
+#ifndef CONSTEXPR_CHECKS_STATIC_FOR_HPP
+#define CONSTEXPR_CHECKS_STATIC_FOR_HPP
+
+#include "constexpr_checks.hpp"
+#include <callable_traits/is_invokable.hpp>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+#ifndef CONSTEXPR_CHECKS_UNROLL_LIMIT
+#define CONSTEXPR_CHECKS_UNROLL_LIMIT 64
+#endif
+
+namespace constexpr_checks {
+
+    template<std::size_t I>
+    using index_constant = std::integral_constant<std::size_t, I>;
+
+    // unroll<N, unroll_limit<Max>> unrolls loops of at most Max
+    // iterations, and falls back to a runtime loop otherwise.
+    template<std::size_t MaxIterations>
+    struct unroll_limit {
+
+        template<typename F, std::size_t N>
+        using unrolls = std::integral_constant<bool, N <= MaxIterations>;
+    };
+
+    using full_unroll = unroll_limit<static_cast<std::size_t>(-1)>;
+
+    // unroll<N, unroll_if_constexpr<Max>> only unrolls loops of at most
+    // Max iterations when every iteration is constexpr-invokable, i.e.
+    // when the unrolled body can fold completely at compile time.
+    template<std::size_t MaxIterations>
+    struct unroll_if_constexpr;
+
+    namespace detail {
+
+        template<typename F, typename Seq>
+        struct unroll_folds_t;
+
+        template<typename F, std::size_t... I>
+        struct unroll_folds_t<F, std::index_sequence<I...>> {
+
+            using type = std::integer_sequence<bool, decltype(
+                ::constexpr_checks::is_constexpr_invokable<
+                    F, index_constant<I>>())::value...>;
+
+            using all = CONSTEXPR_CHECKS_CONJUNCTION(
+                std::integral_constant<bool, decltype(
+                ::constexpr_checks::is_constexpr_invokable<
+                    F, index_constant<I>>())::value>...);
+        };
+
+        // Only probes the iterations of loops within the budget, so that
+        // a long loop falls back to a runtime loop without instantiating
+        // one probe per iteration.
+        template<typename F, std::size_t N, bool WithinBudget>
+        struct unroll_folds_within : std::false_type {};
+
+        template<typename F, std::size_t N>
+        struct unroll_folds_within<F, N, true>
+            : unroll_folds_t<F, std::make_index_sequence<N>>::all {};
+
+        template<typename F, std::size_t... I>
+        inline constexpr void
+        static_for_impl(F& f, std::index_sequence<I...>) {
+
+            // static_cast<void> defends against overloaded commas
+            using expand = int[];
+            static_cast<void>(expand{ 0, (static_cast<void>(
+                f(index_constant<I>{})), 0)... });
+        }
+
+        template<std::size_t N, typename F>
+        inline constexpr void
+        unroll_impl(F& f, std::true_type) {
+            static_for_impl(f, std::make_index_sequence<N>{});
+        }
+
+        template<std::size_t N, typename F>
+        inline constexpr void
+        unroll_impl(F& f, std::false_type) {
+
+            static_assert(decltype(callable_traits::is_invokable<
+                F&, std::size_t>())::value,
+                "This loop exceeds the unroll budget, so it must fall back "
+                "to a runtime loop, but its body cannot be called with a "
+                "std::size_t index.");
+
+            for (std::size_t i = 0; i < N; ++i)
+                f(i);
+        }
+    }
+
+    template<std::size_t MaxIterations>
+    struct unroll_if_constexpr {
+
+        template<typename F, std::size_t N>
+        using unrolls = std::integral_constant<bool,
+            detail::unroll_folds_within<F, N, (N <= MaxIterations)>::value>;
+    };
+
+    // unroll_folds<N, F>() is a std::integer_sequence<bool, ...> whose I-th
+    // element reports whether F is constexpr-invokable with
+    // index_constant<I>, i.e. whether iteration I of static_for<N> folds
+    // completely at compile time.
+    template<std::size_t N, typename F>
+    inline constexpr auto
+    unroll_folds() {
+        return typename detail::unroll_folds_t<
+            F, std::make_index_sequence<N>>::type{};
+    }
+
+    template<std::size_t N, typename F>
+    inline constexpr auto
+    unroll_folds(F&&) {
+        return unroll_folds<N, F&&>();
+    }
+
+    template<std::size_t N, typename F>
+    inline constexpr auto
+    is_constexpr_unrollable() {
+        return typename detail::unroll_folds_t<
+            F, std::make_index_sequence<N>>::all{};
+    }
+
+    template<std::size_t N, typename F>
+    inline constexpr auto
+    is_constexpr_unrollable(F&&) {
+        return is_constexpr_unrollable<N, F&&>();
+    }
+
+    // static_for<N>(f) calls f(index_constant<I>{}) for each I in [0, N),
+    // always fully unrolled.
+    template<std::size_t N, typename F>
+    inline constexpr F
+    static_for(F f) {
+        detail::static_for_impl(f, std::make_index_sequence<N>{});
+        return f;
+    }
+
+    // unroll<N, Policy>(f) behaves like static_for<N>(f) when Policy
+    // allows N iterations to be unrolled, and otherwise calls f(i) with a
+    // std::size_t index in a runtime loop.
+    template<std::size_t N,
+        typename Policy = unroll_limit<CONSTEXPR_CHECKS_UNROLL_LIMIT>,
+        typename F>
+    inline constexpr F
+    unroll(F f) {
+
+        using unrolls = typename Policy::template unrolls<F&, N>;
+
+        detail::unroll_impl<N>(f, std::integral_constant<
+            bool, unrolls::value>{});
+
+        return f;
+    }
+}
+
+#endif //#ifndef CONSTEXPR_CHECKS_STATIC_FOR_HPP
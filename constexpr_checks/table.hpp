@@ -0,0 +1,383 @@
+/*!
+@file
+
+@copyright Barrett Adair 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+*/
+
+#ifndef CONSTEXPR_CHECKS_TABLE_HPP
+#define CONSTEXPR_CHECKS_TABLE_HPP
+
+#include "constexpr_checks.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define CONSTEXPR_CHECKS_MAPPED_TABLE 1
+#endif
+
+// mapped_table checks the checksum of the whole file when it is first
+// mapped. Define this to 0 to skip that pass and only check the header.
+#ifndef CONSTEXPR_CHECKS_TABLE_VERIFY_CHECKSUM
+#define CONSTEXPR_CHECKS_TABLE_VERIFY_CHECKSUM 1
+#endif
+
+namespace constexpr_checks {
+
+    // table_view<T> is the read-only view returned by the get() of every
+    // table type below, whether the table is constant data or a mapped
+    // file.
+    template<typename T>
+    class table_view {
+
+        const T* first_;
+        std::size_t size_;
+
+    public:
+
+        using value_type = T;
+
+        inline constexpr table_view() : first_(nullptr), size_(0) {}
+
+        inline constexpr table_view(const T* first, std::size_t size)
+            : first_(first), size_(size) {}
+
+        inline constexpr const T* data() const { return first_; }
+        inline constexpr std::size_t size() const { return size_; }
+        inline constexpr bool empty() const { return size_ == 0; }
+        inline constexpr const T* begin() const { return first_; }
+        inline constexpr const T* end() const { return first_ + size_; }
+
+        inline constexpr const T& operator[](std::size_t i) const {
+            return first_[i];
+        }
+    };
+
+    namespace detail {
+
+        template<typename F>
+        using table_element = shallow_decay<decltype(
+            std::declval<const F&>()(std::size_t{}))>;
+
+        template<typename T, std::size_t N>
+        struct table_storage {
+            T data[N];
+        };
+
+        template<std::size_t N, typename F>
+        inline constexpr table_storage<table_element<F>, N>
+        generate_table(const F& f) {
+            table_storage<table_element<F>, N> t{};
+            for (std::size_t i = 0; i < N; ++i)
+                t.data[i] = f(i);
+            return t;
+        }
+
+        template<typename F>
+        using is_constexpr_table = decltype(::constexpr_checks::
+            is_constexpr_invokable<F, std::size_t>());
+
+        template<typename F, std::size_t N,
+            bool = is_constexpr_table<F>::value>
+        struct static_table_impl {
+
+            using storage = table_storage<table_element<F>, N>;
+
+            static constexpr storage value =
+                generate_table<N>(CONSTEXPR_CHECKS_MAKE_CONSTEXPR(F&&));
+
+            static inline table_view<table_element<F>> get() {
+                return { value.data, N };
+            }
+        };
+
+        template<typename F, std::size_t N, bool B>
+        constexpr typename static_table_impl<F, N, B>::storage
+        static_table_impl<F, N, B>::value;
+
+        template<typename F, std::size_t N>
+        struct static_table_impl<F, N, false> {
+
+            using storage = table_storage<table_element<F>, N>;
+
+            static inline table_view<table_element<F>> get() {
+                static const storage value = generate_table<N>(F{});
+                return { value.data, N };
+            }
+        };
+    }
+
+    // static_table<F, N>::get() returns a view of the N elements F(0),
+    // F(1), ..., F(N - 1), where F is a stateless function object. When
+    // F is constexpr-invokable with an std::size_t, the table is generated
+    // at compile time and emitted as constant data. Otherwise, it is
+    // generated once, on first use.
+    //
+    // Constant evaluation is bounded by the compiler's step and loop
+    // limits (e.g. 2^18 iterations per loop for GCC), and by its memory
+    // use. Tables that do not fit can be spilled to a file at build time
+    // with mapped_table, which has the same API.
+    template<typename F, std::size_t N>
+    struct static_table : detail::static_table_impl<F, N> {
+
+        using value_type = detail::table_element<F>;
+        using is_constexpr = detail::is_constexpr_table<F>;
+
+        static inline constexpr std::size_t size() { return N; }
+    };
+
+    // thrown by write_table and mapped_table
+    struct table_error : std::runtime_error {
+        using std::runtime_error::runtime_error;
+    };
+
+    namespace detail {
+
+        // The file format of write_table and mapped_table: a table_header,
+        // zero padding up to table_data_offset, then the elements.
+        // Increment table_format_version when the layout changes.
+        constexpr std::uint32_t table_format_version = 1;
+        constexpr std::uint32_t table_byte_order = 0x01020304;
+        constexpr std::size_t table_data_offset = 64;
+
+        struct table_header {
+            char magic[8];
+            std::uint32_t version;
+            std::uint32_t byte_order;
+            std::uint32_t element_size;
+            std::uint32_t element_align;
+            std::uint64_t count;
+            std::uint64_t checksum;
+        };
+
+        static_assert(sizeof(table_header) <= table_data_offset, "");
+
+        // eight bytes, with the terminating '\0'
+        inline const char* table_magic() { return "CCTABLE"; }
+
+        // 64-bit FNV-1a over 8-byte words, then over the remaining bytes
+        inline std::uint64_t
+        table_checksum(const unsigned char* p, std::size_t n) {
+            const std::uint64_t prime = 0x100000001b3u;
+            std::uint64_t h = 0xcbf29ce484222325u;
+            for (; n >= 8; p += 8, n -= 8) {
+                std::uint64_t word;
+                std::memcpy(&word, p, 8);
+                h = (h ^ word) * prime;
+            }
+            for (; n != 0; ++p, --n)
+                h = (h ^ *p) * prime;
+            return h;
+        }
+
+        template<typename T>
+        inline table_header
+        make_table_header(std::size_t count, std::uint64_t checksum) {
+            table_header h{};
+            std::memcpy(h.magic, table_magic(), sizeof(h.magic));
+            h.version = table_format_version;
+            h.byte_order = table_byte_order;
+            h.element_size = static_cast<std::uint32_t>(sizeof(T));
+            h.element_align = static_cast<std::uint32_t>(alignof(T));
+            h.count = count;
+            h.checksum = checksum;
+            return h;
+        }
+
+        template<typename F>
+        struct check_table_element {
+
+            using type = table_element<F>;
+
+            static_assert(is_constexpr_table<F>::value,
+                "The element function of a spilled table must be "
+                "constexpr-invokable with an std::size_t, so that the "
+                "file holds the table that static_table would generate.");
+
+            static_assert(std::is_trivially_copyable<type>::value,
+                "Spilled table elements are read from the file in place, "
+                "so they must be trivially copyable.");
+
+            static_assert(alignof(type) <= table_data_offset,
+                "Spilled table elements cannot be over-aligned.");
+        };
+    }
+
+    // write_table<F, N>(path) generates the table of static_table<F, N>
+    // at runtime and writes it to 'path' for mapped_table. It is meant
+    // to be called from a small host tool that runs during the build,
+    // such as:
+    //
+    //     int main(int, char** argv) {
+    //         constexpr_checks::write_table<my_element, 1 << 24>(argv[1]);
+    //     }
+    //
+    // The file is written next to 'path', then renamed over it, so an
+    // interrupted build never leaves a truncated table behind. Throws
+    // table_error on failure.
+    template<typename F, std::size_t N>
+    inline void
+    write_table(const char* path) {
+
+        using T = typename detail::check_table_element<F>::type;
+
+        // Padding bytes are written to the file and the checksum, so they
+        // must not be indeterminate, or the same generator could give a
+        // different file on every build. The elements are zero-initialized,
+        // padding included, then each one is constructed in place, which
+        // only writes its members.
+        std::vector<T> elements(N);
+        const F f{};
+        for (std::size_t i = 0; i < N; ++i)
+            ::new (static_cast<void*>(&elements[i])) T(f(i));
+
+        const auto bytes = reinterpret_cast<const unsigned char*>(
+            elements.data());
+
+        const detail::table_header header = detail::make_table_header<T>(
+            N, detail::table_checksum(bytes, N * sizeof(T)));
+
+        unsigned char prefix[detail::table_data_offset] = {};
+        std::memcpy(prefix, &header, sizeof(header));
+
+        const std::string tmp = std::string(path) + ".tmp";
+        std::FILE* out = std::fopen(tmp.c_str(), "wb");
+        if (out == nullptr)
+            throw table_error(tmp + ": cannot open for writing");
+
+        bool ok = std::fwrite(prefix, 1, sizeof(prefix), out)
+                == sizeof(prefix)
+            && std::fwrite(bytes, sizeof(T), N, out) == N;
+        ok = std::fclose(out) == 0 && ok;
+
+        if (!ok || std::rename(tmp.c_str(), path) != 0) {
+            std::remove(tmp.c_str());
+            throw table_error(std::string(path) + ": cannot write table");
+        }
+    }
+
+#ifdef CONSTEXPR_CHECKS_MAPPED_TABLE
+
+    namespace detail {
+
+        // a read-only mapping of a table file, checked against the
+        // element type and count that the program expects
+        class table_mapping {
+
+            void* address_;
+            std::size_t length_;
+
+            [[noreturn]] void fail(const char* path, const char* what) {
+                if (address_ != nullptr)
+                    ::munmap(address_, length_);
+                throw table_error(std::string(path) + ": " + what);
+            }
+
+        public:
+
+            table_mapping(const char* path, std::size_t element_size,
+                std::size_t element_align, std::size_t count)
+                : address_(nullptr), length_(0) {
+
+                const int fd = ::open(path, O_RDONLY | O_CLOEXEC);
+                if (fd < 0)
+                    fail(path, "cannot open table");
+
+                struct stat st;
+                if (::fstat(fd, &st) != 0) {
+                    ::close(fd);
+                    fail(path, "cannot stat table");
+                }
+
+                length_ = static_cast<std::size_t>(st.st_size);
+                if (length_ != table_data_offset + element_size * count) {
+                    ::close(fd);
+                    fail(path, "table has the wrong size");
+                }
+
+                void* p = ::mmap(nullptr, length_, PROT_READ,
+                    MAP_PRIVATE, fd, 0);
+                ::close(fd);
+                if (p == MAP_FAILED)
+                    fail(path, "cannot map table");
+                address_ = p;
+
+                table_header h;
+                std::memcpy(&h, address_, sizeof(h));
+
+                if (std::memcmp(h.magic, table_magic(), sizeof(h.magic)) != 0)
+                    fail(path, "not a table file");
+                if (h.version != table_format_version)
+                    fail(path, "unsupported table format version");
+                if (h.byte_order != table_byte_order)
+                    fail(path, "table was written with another byte order");
+                if (h.element_size != element_size
+                    || h.element_align != element_align
+                    || h.count != count)
+                    fail(path, "table does not match the element type "
+                        "or count");
+
+#if CONSTEXPR_CHECKS_TABLE_VERIFY_CHECKSUM
+                if (h.checksum != table_checksum(data(), length_
+                        - table_data_offset))
+                    fail(path, "table checksum mismatch");
+#endif
+            }
+
+            table_mapping(const table_mapping&) = delete;
+            table_mapping& operator=(const table_mapping&) = delete;
+
+            ~table_mapping() {
+                ::munmap(address_, length_);
+            }
+
+            const unsigned char* data() const {
+                return static_cast<const unsigned char*>(address_)
+                    + table_data_offset;
+            }
+        };
+    }
+
+    // mapped_table<F, N, Path> has the API of static_table<F, N>, but
+    // get() returns a view of the file written by write_table<F, N>,
+    // memory-mapped read-only, without copying. Path is a stateless
+    // function object that returns the path of the file. The file is
+    // mapped and checked on first use, and stays mapped until exit.
+    // Throws table_error if the file is missing, was written for another
+    // element type or count, or is corrupt.
+    template<typename F, std::size_t N, typename Path>
+    struct mapped_table {
+
+        using value_type =
+            typename detail::check_table_element<F>::type;
+
+        using is_constexpr = std::false_type;
+
+        static inline table_view<value_type> get() {
+            static const detail::table_mapping mapping{ Path{}(),
+                sizeof(value_type), alignof(value_type), N };
+            return { reinterpret_cast<const value_type*>(mapping.data()),
+                N };
+        }
+
+        static inline constexpr std::size_t size() { return N; }
+    };
+
+#endif //#ifdef CONSTEXPR_CHECKS_MAPPED_TABLE
+}
+
+#endif //#ifndef CONSTEXPR_CHECKS_TABLE_HPP
@@ -0,0 +1,119 @@
+/*!
+@file
+
+@copyright Barrett Adair 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+*/
+
+#ifndef CONSTEXPR_CHECKS_TRANSIENT_HPP
+#define CONSTEXPR_CHECKS_TRANSIENT_HPP
+
+#include "constexpr_checks.hpp"
+#include <array>
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+// C++20 allows new/delete, and therefore std::vector and std::string,
+// during constant evaluation, as long as every allocation is released
+// before the evaluation ends.
+#ifdef __cpp_constexpr_dynamic_alloc
+
+namespace constexpr_checks {
+
+    namespace detail {
+
+        // build<F, Args...>() calls the builder F with the 'value' member
+        // of each Arg. F is either an integral_constant wrapping a
+        // function pointer or a constexpr-constructible function object.
+        template<typename F, typename... Args>
+        inline constexpr decltype(auto) build() {
+            return probe_target<F>::get()(Args::value...);
+        }
+
+        template<typename F, typename... Args>
+        using build_result = shallow_decay<decltype(build<F, Args...>())>;
+
+        template<typename F, typename... Args>
+        struct is_constexpr_transient_t {
+
+            // the whole comma expression is one constant evaluation, so
+            // the result (and everything it allocated) must be destroyed
+            // before the template argument is complete.
+            template<typename T, typename = typename std::enable_if<
+                is_constexpr_constructible<T>::value>::type,
+                typename = std::integral_constant<bool,
+                    (static_cast<void>(build<T, Args...>()), true)>>
+            static std::true_type test(int);
+
+            template<typename>
+            static std::false_type test(...);
+
+            using type = decltype(test<shallow_decay<F>>(0));
+        };
+
+        template<typename F, typename... Args>
+        inline constexpr std::size_t transient_size() {
+            return std::size(build<F, Args...>());
+        }
+
+        template<typename F, typename... Args>
+        inline constexpr auto copy_to_array() {
+
+            using result = build_result<F, Args...>;
+            using value_type = std::remove_cv_t<std::remove_reference_t<
+                decltype(*std::begin(std::declval<result&>()))>>;
+
+            std::array<value_type, transient_size<F, Args...>()> out{};
+            auto&& r = build<F, Args...>();
+            auto it = std::begin(r);
+            for (std::size_t i = 0; i < out.size(); ++i)
+                out[i] = *it++;
+            return out;
+        }
+    }
+
+    // is_constexpr_transient<F, Args...>() returns std::true_type when
+    // calling F with each Args::value, and destroying the result, is a
+    // constant expression. Unlike is_constexpr, the call is made with the
+    // real arguments, so builders that allocate and free memory internally
+    // (std::vector, std::string) are told apart from runtime-only ones,
+    // and builders that leak their allocations report false.
+    template<typename F, typename... Args>
+    inline constexpr auto
+    is_constexpr_transient() {
+        return typename detail::is_constexpr_transient_t<
+            F, Args...>::type{};
+    }
+
+    template<typename... Args, typename F>
+    inline constexpr auto
+    is_constexpr_transient(F&&) {
+        return typename detail::is_constexpr_transient_t<
+            F, Args...>::type{};
+    }
+
+    // to_constexpr_array<F, Args...>() runs the builder F at compile time
+    // and copies its result, any range with a constexpr std::size, into
+    // an std::array that outlives the transient allocation. The builder
+    // runs twice: once for the size, once for the elements. Strings are
+    // copied without their null terminator.
+    template<typename F, typename... Args>
+    inline constexpr auto
+    to_constexpr_array() {
+        return detail::copy_to_array<F, Args...>();
+    }
+
+    // constexpr_array<F, Args...> is the same array as a constexpr
+    // variable, so that it is emitted once into read-only data.
+    template<typename F, typename... Args>
+    inline constexpr auto constexpr_array =
+        detail::copy_to_array<F, Args...>();
+}
+
+#endif //#ifdef __cpp_constexpr_dynamic_alloc
+
+#endif //#ifndef CONSTEXPR_CHECKS_TRANSIENT_HPP
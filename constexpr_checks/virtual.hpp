@@ -0,0 +1,150 @@
+/*!
+@file
+
+@copyright Barrett Adair 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+*/
+
+#ifndef CONSTEXPR_CHECKS_VIRTUAL_HPP
+#define CONSTEXPR_CHECKS_VIRTUAL_HPP
+
+#include "constexpr_checks.hpp"
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+// constexpr virtual functions (P1064) are a C++20 feature
+#if defined(__cpp_constexpr) && __cpp_constexpr >= 201907L
+
+namespace constexpr_checks {
+
+    namespace detail {
+
+        template<std::size_t>
+        using virtual_arg_worm = constexpr_template_worm;
+
+        // the constexpr D object that overrides are called on
+        template<typename D>
+        inline constexpr D virtual_object{};
+
+        // virtual_probe<P, Derived> calls the member function P::value of
+        // a base class on the constexpr Derived object. The call goes
+        // through the base, so it dispatches to Derived's final overrider
+        // during constant evaluation.
+        template<typename P, typename Derived,
+            typename = typename std::remove_cv<decltype(P::value)>::type>
+        struct virtual_probe {
+            static constexpr bool value = false;
+        };
+
+        template<typename P, typename Derived,
+            typename Member, typename Base>
+        struct virtual_probe<P, Derived, Member Base::*> {
+
+            using pmf = Member Base::*;
+
+            using object = callable_traits::qualified_parent_class_of<pmf>;
+
+            template<typename... Worms, typename D = Derived,
+                typename = typename std::enable_if<
+                    std::is_base_of<Base, D>::value
+                    && is_constexpr_constructible<D>::value>::type,
+                typename = std::integral_constant<bool,
+                    (static_cast<void>((static_cast<object>(const_cast<D&>(
+                        virtual_object<D>)).*P::value)(
+                            Worms{}...)), true)>>
+            static std::true_type test(int);
+
+            template<typename...>
+            static std::false_type test(...);
+
+            template<typename Seq>
+            struct probe;
+
+            template<std::size_t... I>
+            struct probe<std::index_sequence<I...>> {
+                using type = decltype(test<virtual_arg_worm<I>...>(0));
+            };
+
+            // arity<T> counts the INVOKE-required object
+            static constexpr bool value = std::is_function<Member>::value
+                && (arity<pmf>::value > 0)
+                && probe<std::make_index_sequence<
+                    (arity<pmf>::value > 0 ? arity<pmf>::value - 1 : 0)>>
+                        ::type::value;
+        };
+
+        template<typename P, typename Signature>
+        struct virtual_dispatch;
+
+#define CONSTEXPR_CHECKS_VIRTUAL_DISPATCH(QUAL)                             \
+        template<typename P, typename R, typename Base, typename... Params> \
+        struct virtual_dispatch<P, R(Base::*)(Params...) QUAL> {            \
+                                                                            \
+            using base = Base;                                              \
+            using function_type = R(*)(Params...);                          \
+                                                                            \
+            template<typename D>                                            \
+            static constexpr R call(Params... params) {                     \
+                return (static_cast<const Base&>(virtual_object<D>)         \
+                    .*P::value)(static_cast<Params&&>(params)...);          \
+            }                                                               \
+        };                                                                  \
+/**/
+
+        CONSTEXPR_CHECKS_VIRTUAL_DISPATCH(const)
+        CONSTEXPR_CHECKS_VIRTUAL_DISPATCH(const noexcept)
+    }
+
+    // constexpr_overrides<P, Derived...>() returns an
+    // std::integer_sequence<bool, ...> that says, for each Derived, whether
+    // calling the base class member function P (an integral_constant
+    // pointer to member function) on a constexpr Derived object is a
+    // constant expression, i.e. whether Derived's override is constexpr.
+    template<typename P, typename... Derived>
+    inline constexpr auto
+    constexpr_overrides() {
+        return std::integer_sequence<bool,
+            detail::virtual_probe<P, Derived>::value...>{};
+    }
+
+    template<auto P, typename... Derived>
+    inline constexpr auto
+    constexpr_overrides() {
+        return constexpr_overrides<
+            std::integral_constant<decltype(P), P>, Derived...>();
+    }
+
+    // virtual_dispatch_table<P, Derived...> is a constant table of one
+    // function per Derived, each calling P on a constexpr Derived object.
+    // The dynamic type of each call is known at compile time, so the
+    // compiler can inline the override instead of loading the vtable.
+    // It only accepts stateless hierarchies where every override is
+    // constexpr, i.e. policies selected by index at runtime.
+    template<typename P, typename... Derived>
+    struct virtual_dispatch_table
+        : detail::virtual_dispatch<P,
+            typename std::remove_cv<decltype(P::value)>::type> {
+
+        using dispatch = detail::virtual_dispatch<P,
+            typename std::remove_cv<decltype(P::value)>::type>;
+
+        static_assert(CONSTEXPR_CHECKS_CONJUNCTION(
+            std::integral_constant<bool,
+                detail::virtual_probe<P, Derived>::value>...)::value,
+            "virtual_dispatch_table requires a constexpr override in "
+            "every Derived type.");
+
+        static constexpr typename dispatch::function_type value[] = {
+            &dispatch::template call<Derived>...
+        };
+
+        static constexpr std::size_t size() { return sizeof...(Derived); }
+    };
+}
+
+#endif //#if defined(__cpp_constexpr) && __cpp_constexpr >= 201907L
+
+#endif //#ifndef CONSTEXPR_CHECKS_VIRTUAL_HPP
@@ -0,0 +1,156 @@
+/*!
+@file
+
+@copyright Barrett Adair 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+*/
+
+#ifndef CONSTEXPR_CHECKS_VISIT_HPP
+#define CONSTEXPR_CHECKS_VISIT_HPP
+
+#include "constexpr_checks.hpp"
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+#if __cplusplus >= 201703L
+#include <variant>
+#endif
+
+// constexpr_visit visits variants of at most this many alternatives with
+// a chain of index comparisons when the visitor is not constexpr, and
+// larger ones with std::visit.
+#ifndef CONSTEXPR_CHECKS_VISIT_SWITCH_LIMIT
+#define CONSTEXPR_CHECKS_VISIT_SWITCH_LIMIT 8
+#endif
+
+#ifdef __cpp_lib_variant
+
+namespace constexpr_checks {
+
+    namespace detail {
+
+        template<typename Variant>
+        using variant_size_of =
+            std::variant_size<std::remove_reference_t<Variant>>;
+
+        // the alternative as the visitor receives it, with the value
+        // category and cv-qualifiers of Variant
+        template<std::size_t I, typename Variant>
+        using variant_get_result = decltype(
+            std::get<I>(std::declval<Variant>()));
+
+        template<typename Visitor, typename Variant>
+        using visit_result = decltype(std::declval<Visitor>()(
+            std::get<0>(std::declval<Variant>())));
+
+        template<typename Visitor, typename Variant, typename Seq>
+        struct visit_table;
+
+        template<typename Visitor, typename Variant, std::size_t... I>
+        struct visit_table<Visitor, Variant, std::index_sequence<I...>> {
+
+            using result = visit_result<Visitor, Variant>;
+
+            using dispatch_type = result(*)(Visitor&&, Variant&&);
+
+            template<std::size_t J>
+            static constexpr result dispatch(Visitor&& vis, Variant&& v) {
+                return static_cast<Visitor&&>(vis)(
+                    std::get<J>(static_cast<Variant&&>(v)));
+            }
+
+            // one function pointer per alternative, in read-only data
+            static constexpr dispatch_type value[] = { &dispatch<I>... };
+
+            // is_constexpr_invokable for the visitor with every alternative
+            using is_constexpr = CONSTEXPR_CHECKS_CONJUNCTION(
+                std::integral_constant<bool, decltype(
+                    ::constexpr_checks::is_constexpr_invokable<Visitor,
+                        variant_get_result<I, Variant>>())::value>...);
+        };
+
+        // whether the visitor returns the same type for every alternative,
+        // which std::visit requires
+        template<typename Visitor, typename Variant, typename Seq>
+        struct visit_results_agree;
+
+        template<typename Visitor, typename Variant, std::size_t... I>
+        struct visit_results_agree<Visitor, Variant,
+                std::index_sequence<I...>>
+            : CONSTEXPR_CHECKS_CONJUNCTION(std::is_same<
+                visit_result<Visitor, Variant>,
+                decltype(std::declval<Visitor>()(
+                    std::declval<variant_get_result<I, Variant>>()))>...) {};
+
+        template<typename Visitor, typename Variant>
+        using visit_table_of = visit_table<Visitor, Variant,
+            std::make_index_sequence<variant_size_of<Variant>::value>>;
+
+        template<std::size_t I, typename Visitor, typename Variant>
+        constexpr visit_result<Visitor, Variant>
+        switch_visit(Visitor&& vis, Variant&& v) {
+            if constexpr (I + 1 == variant_size_of<Variant>::value) {
+                return static_cast<Visitor&&>(vis)(
+                    std::get<I>(static_cast<Variant&&>(v)));
+            } else {
+                if (v.index() == I)
+                    return static_cast<Visitor&&>(vis)(
+                        std::get<I>(static_cast<Variant&&>(v)));
+                return switch_visit<I + 1>(static_cast<Visitor&&>(vis),
+                    static_cast<Variant&&>(v));
+            }
+        }
+    }
+
+    // is_constexpr_visitor<Visitor, Variant>() checks whether Visitor is
+    // constexpr-invokable with every alternative of the std::variant.
+    template<typename Visitor, typename Variant>
+    inline constexpr auto
+    is_constexpr_visitor() {
+        return typename detail::visit_table_of<
+            Visitor, Variant>::is_constexpr{};
+    }
+
+    // constexpr_visit(vis, v) visits a single std::variant like std::visit,
+    // and, like it, requires the same result type for every alternative.
+    // When is_constexpr_visitor holds, it dispatches through a constexpr
+    // table of function pointers, which is emitted as read-only data, and
+    // the whole visit folds when the variant is a constant. Otherwise, it
+    // visits small variants with branches and larger ones with std::visit.
+    // Neither strategy is faster than std::visit at runtime on every
+    // standard library; see bench/visit.cpp.
+    template<typename Visitor, typename Variant>
+    inline constexpr decltype(auto)
+    constexpr_visit(Visitor&& vis, Variant&& v) {
+
+        using table = detail::visit_table_of<Visitor&&, Variant&&>;
+
+        static_assert(detail::visit_results_agree<Visitor&&, Variant&&,
+            std::make_index_sequence<detail::variant_size_of<
+                Variant>::value>>::value,
+            "The visitor must return the same type for every alternative.");
+
+        if constexpr (table::is_constexpr::value) {
+            if (v.valueless_by_exception())
+                throw std::bad_variant_access{};
+            return table::value[v.index()](
+                std::forward<Visitor>(vis), std::forward<Variant>(v));
+        } else if constexpr (detail::variant_size_of<Variant>::value
+                > CONSTEXPR_CHECKS_VISIT_SWITCH_LIMIT) {
+            return std::visit(
+                std::forward<Visitor>(vis), std::forward<Variant>(v));
+        } else {
+            if (v.valueless_by_exception())
+                throw std::bad_variant_access{};
+            return detail::switch_visit<0>(
+                std::forward<Visitor>(vis), std::forward<Variant>(v));
+        }
+    }
+}
+
+#endif //#ifdef __cpp_lib_variant
+
+#endif //#ifndef CONSTEXPR_CHECKS_VISIT_HPP
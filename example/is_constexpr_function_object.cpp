@@ -51,12 +51,29 @@ struct add {
 static_assert(!is_constexpr<add>(), "");
 static_assert(!is_constexpr(add{}), "");
 
+// Capture-less lambdas are checked through their conversion to a function
+// pointer. Generic lambdas don't have one until the argument types are
+// known, so 'multiply' can only be checked where closure types are default
+// constructible (C++20).
 auto multiply = [](auto t1, auto t2) -> decltype(t1.value * t2.value) {
     return t1.value * t2.value;
 };
 
+#if __cplusplus > 201703L
+static_assert(is_constexpr<decltype(multiply)>(), "");
+static_assert(is_constexpr(multiply), "");
+#else
 static_assert(!is_constexpr<decltype(multiply)>(), "");
 static_assert(!is_constexpr(multiply), "");
+#endif
+
+// Lambdas are implicitly constexpr since C++17
+auto negate = [](int i) { return -i; };
+
+#if defined(__cpp_constexpr) && __cpp_constexpr >= 201603
+static_assert(is_constexpr<decltype(negate)>(), "");
+static_assert(is_constexpr(negate), "");
+#endif
 
 
 // is_constexpr will always return std::false_type when the argument
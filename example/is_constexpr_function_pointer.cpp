@@ -28,4 +28,13 @@ static_assert(is_constexpr<F>(), "");
 static_assert(!is_constexpr(B{}), "");
 static_assert(!is_constexpr<B>(), "");
 
+#ifdef __cpp_nontype_template_parameter_auto
+
+// in C++17, function pointers can also be passed as template arguments
+static_assert(is_constexpr<&foo>(), "");
+static_assert(!is_constexpr<&bar>(), "");
+static_assert(is_constexpr_invokable<&foo, int>(), "");
+
+#endif
+
 int main() {}
@@ -0,0 +1,116 @@
+/*!
+Copyright (c) 2016 Barrett Adair
+
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+*/
+
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <numeric>
+#include "constexpr_checks/algorithm.hpp"
+
+#ifndef CC_ASSERT
+#define CC_ASSERT(...) static_assert(__VA_ARGS__, #__VA_ARGS__)
+#endif //CC_ASSERT
+
+using namespace constexpr_checks;
+
+struct square {
+    constexpr unsigned operator()(unsigned i) const { return i * i; }
+};
+
+struct plus {
+    constexpr unsigned operator()(unsigned a, unsigned b) const {
+        return a + b;
+    }
+};
+
+struct bit_xor {
+    unsigned operator()(unsigned a, unsigned b) const { return a ^ b; }
+};
+
+constexpr std::array<unsigned, 5> values = {{ 1, 2, 3, 4, 5 }};
+
+// writing to an std::array during constant evaluation requires C++17
+#if defined(__cpp_constexpr) && __cpp_constexpr >= 201603
+
+namespace test1 {
+
+    constexpr auto squares = constexpr_transform(values, square{});
+    CC_ASSERT(squares[0] == 1 && squares[4] == 25);
+
+    constexpr auto sums = constexpr_inclusive_scan(values, plus{});
+    CC_ASSERT(sums[0] == 1 && sums[1] == 3 && sums[4] == 15);
+
+    CC_ASSERT(constexpr_reduce(values, 0u, plus{}) == 15);
+    CC_ASSERT(constexpr_reduce(squares, 10u, plus{}) == 65);
+
+    constexpr std::array<unsigned, 0> empty = {};
+    CC_ASSERT(constexpr_reduce(empty, 7u, plus{}) == 7);
+}
+
+#endif
+
+// large enough to take the parallel path
+constexpr std::size_t large = CONSTEXPR_CHECKS_PARALLEL_THRESHOLD * 3 + 7;
+
+using large_array = std::array<unsigned, large>;
+
+int main() {
+
+    int result = 0;
+
+    // runtime results match the sequential standard algorithms bit for bit
+    auto in = std::unique_ptr<large_array>(new large_array);
+    auto out = std::unique_ptr<large_array>(new large_array);
+    auto expected = std::unique_ptr<large_array>(new large_array);
+
+    for (std::size_t i = 0; i < large; ++i)
+        (*in)[i] = static_cast<unsigned>(i * 2654435761u);
+
+    constexpr_transform(*in, *out, square{});
+    std::transform(in->begin(), in->end(), expected->begin(), square{});
+    result |= *out != *expected;
+
+    constexpr_inclusive_scan(*in, *out, plus{});
+    std::partial_sum(in->begin(), in->end(), expected->begin(), plus{});
+    result |= *out != *expected;
+
+    constexpr_inclusive_scan(*in, *out, bit_xor{});
+    std::partial_sum(in->begin(), in->end(), expected->begin(), bit_xor{});
+    result |= *out != *expected;
+
+    result |= constexpr_reduce(*in, 3u, plus{})
+        != std::accumulate(in->begin(), in->end(), 3u, plus{});
+
+    result |= constexpr_reduce(*in, 3u, bit_xor{})
+        != std::accumulate(in->begin(), in->end(), 3u, bit_xor{});
+
+    // and the loops that constant evaluation runs
+    auto sequential = std::unique_ptr<large_array>(new large_array);
+    plus add;
+    bit_xor xor_;
+
+    constexpr_inclusive_scan(*in, *out, plus{});
+    detail::inclusive_scan_n(in->data(), sequential->data(), large, add);
+    result |= *out != *sequential;
+
+    constexpr_inclusive_scan(*in, *out, bit_xor{});
+    detail::inclusive_scan_n(in->data(), sequential->data(), large, xor_);
+    result |= *out != *sequential;
+
+    result |= constexpr_reduce(*in, 3u, plus{})
+        != detail::reduce_n(in->data(), large, 3u, add);
+
+    result |= constexpr_reduce(*in, 3u, bit_xor{})
+        != detail::reduce_n(in->data(), large, 3u, xor_);
+
+    // small arrays take the sequential runtime path
+    auto squares = constexpr_transform(values, square{});
+    result |= squares[2] != 9;
+    result |= constexpr_reduce(values, 0u, bit_xor{}) != 1;
+
+    return result;
+}
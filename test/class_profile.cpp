@@ -0,0 +1,111 @@
+/*!
+Copyright (c) 2016 Barrett Adair
+
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+*/
+
+#include <type_traits>
+#include "constexpr_checks/class_profile.hpp"
+
+#ifndef CC_ASSERT
+#define CC_ASSERT(...) static_assert(__VA_ARGS__, #__VA_ARGS__)
+#endif //CC_ASSERT
+
+using constexpr_checks::constexpr_profile;
+
+#define CC_MEMBER(...) \
+    std::integral_constant<decltype(__VA_ARGS__), __VA_ARGS__>
+
+namespace test1 {
+
+    struct base {
+        constexpr int id() const { return 1; }
+    };
+
+    struct point : base {
+        int x = 0;
+        int y = 0;
+
+        constexpr int sum() const { return x + y; }
+        int norm() const { return x * x + y * y; }
+        constexpr point scale(int k) const { return { x * k, y * k }; }
+        constexpr int at(int i, int j) const { return i * x + j * y; }
+        constexpr point&& moved() && { return static_cast<point&&>(*this); }
+        constexpr int set(int i) { return x = i; }
+        template<typename T>
+        constexpr T as() const { return T(x); }
+
+        constexpr point() = default;
+        constexpr point(int a, int b) : x(a), y(b) {}
+    };
+
+    constexpr auto p = constexpr_profile<point,
+        CC_MEMBER(&point::sum),
+        CC_MEMBER(&point::norm),
+        CC_MEMBER(&point::scale),
+        CC_MEMBER(&point::at),
+        CC_MEMBER(&point::moved),
+        CC_MEMBER(&point::set),
+        CC_MEMBER(&point::as<long>),
+        CC_MEMBER(&point::id),
+        CC_MEMBER(&point::x)>();
+
+    CC_ASSERT(p.size() == 9);
+
+    CC_ASSERT(p[0].invokable && p[0].constexpr_invokable);
+    CC_ASSERT(p[0].min_arity == 0);
+
+    CC_ASSERT(p[1].invokable && !p[1].constexpr_invokable);
+
+    CC_ASSERT(p[2].constexpr_invokable && p[2].min_arity == 1);
+    CC_ASSERT(p[3].constexpr_invokable && p[3].min_arity == 2);
+    CC_ASSERT(p[4].constexpr_invokable);
+
+    // writes to the constexpr object
+    CC_ASSERT(p[5].invokable && !p[5].constexpr_invokable);
+
+    CC_ASSERT(p[6].constexpr_invokable);
+
+    // inherited
+    CC_ASSERT(p[7].constexpr_invokable);
+
+    CC_ASSERT(!p[8].invokable && p[8].min_arity == -1);
+}
+
+namespace test2 {
+
+    struct other {
+        constexpr int f() const { return 0; }
+    };
+
+    // not a member of a base of test1::point
+    constexpr auto p = constexpr_profile<test1::point, CC_MEMBER(&other::f)>();
+    CC_ASSERT(!p[0].invokable && !p[0].constexpr_invokable);
+
+    // not a literal type
+    struct runtime_only {
+        runtime_only() {}
+        constexpr int f() const { return 0; }
+    };
+
+    constexpr auto q = constexpr_profile<runtime_only,
+        CC_MEMBER(&runtime_only::f)>();
+    CC_ASSERT(q[0].invokable && !q[0].constexpr_invokable);
+
+    CC_ASSERT(constexpr_profile<test1::point>().size() == 0);
+}
+
+#ifdef __cpp_nontype_template_parameter_auto
+
+namespace test3 {
+
+    using test1::point;
+
+    constexpr auto p = constexpr_profile<point, &point::sum, &point::norm>();
+    CC_ASSERT(p[0].constexpr_invokable && !p[1].constexpr_invokable);
+}
+
+#endif //#ifdef __cpp_nontype_template_parameter_auto
+
+int main() {}
@@ -0,0 +1,60 @@
+#!/bin/sh
+# Copyright Barrett Adair 2016
+# Distributed under the Boost Software License, Version 1.0.
+# (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+#
+# Builds tools/classify and runs it on test/classify/probes.txt. Then it
+# compiles test/classify/check.cpp against the generated header, which
+# checks every recorded result. A second run must take every result from
+# the cache, and a run whose flags cannot find the library must fail
+# without writing a header.
+#
+# Usage, from the repository root:
+#
+#   CXX=g++ CXXFLAGS="-std=c++14 -I/path/to/callable_traits/include" \
+#       sh test/classify.sh
+
+CXX=${CXX:-c++}
+CXXFLAGS=${CXXFLAGS:--std=c++14}
+
+tmp=$(mktemp -d) || exit 1
+trap 'rm -rf "$tmp"' EXIT
+
+fail() {
+    echo "classify: $*" >&2
+    exit 1
+}
+
+$CXX -std=c++17 -O2 -pthread tools/classify.cpp -o "$tmp/classify" ||
+    fail "the tool does not compile"
+
+classify() {
+    "$tmp/classify" --cxx "$CXX" --flags "$CXXFLAGS -I." \
+        --cache "$tmp/cache" -o "$tmp/classified_probes.hpp" \
+        test/classify/probes.txt 2>&1
+}
+
+first=$(classify) || fail "first run failed:
+$first"
+echo "$first" | grep -q '6 probes (0 cached)' ||
+    fail "unexpected first run:
+$first"
+echo "$first" | grep -q 'misspelled: the types do not compile' ||
+    fail "the misspelled probe was not reported:
+$first"
+
+second=$(classify) || fail "second run failed:
+$second"
+echo "$second" | grep -q '6 probes (5 cached)' ||
+    fail "the second run did not use the cache:
+$second"
+
+# without -I., neither the library nor the probed code can be found
+if "$tmp/classify" --cxx "$CXX" --flags "$CXXFLAGS" --cache "$tmp/cache" \
+        -o "$tmp/broken.hpp" test/classify/probes.txt >/dev/null 2>&1 ||
+        [ -e "$tmp/broken.hpp" ]; then
+    fail "a broken setup was not reported"
+fi
+
+$CXX $CXXFLAGS -I. -I"$tmp" -fsyntax-only test/classify/check.cpp ||
+    fail "the generated header does not hold the expected results"
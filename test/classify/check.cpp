@@ -0,0 +1,40 @@
+/*!
+Copyright (c) 2016 Barrett Adair
+
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+*/
+
+// Compiled by test/classify.sh against the header that tools/classify
+// generates from test/classify/probes.txt.
+
+#include "classified_probes.hpp"
+
+#ifndef CC_ASSERT
+#define CC_ASSERT(...) static_assert(__VA_ARGS__, #__VA_ARGS__)
+#endif //CC_ASSERT
+
+using namespace constexpr_checks;
+
+template<typename F, typename... Args>
+constexpr probe_result result = classified<F, Args...>::value;
+
+using twice = std::integral_constant<decltype(&legacy::twice),
+    &legacy::twice>;
+
+CC_ASSERT(result<legacy::add, int, int>
+    == probe_result::constexpr_invokable);
+CC_ASSERT(result<legacy::log, int>
+    == probe_result::not_constexpr_invokable);
+CC_ASSERT(result<legacy::size_of, std::array<int, 3>>
+    == probe_result::constexpr_invokable);
+CC_ASSERT(result<legacy::size_of, int> == probe_result::hard_error);
+CC_ASSERT(result<twice, int> == probe_result::constexpr_invokable);
+
+// not probed
+CC_ASSERT(result<legacy::add, long> == probe_result::unclassified);
+
+CC_ASSERT(is_classified_constexpr_invokable<legacy::add, int, int>());
+CC_ASSERT(!is_classified_constexpr_invokable<legacy::size_of, int>());
+
+int main() {}
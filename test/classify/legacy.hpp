@@ -0,0 +1,34 @@
+/*!
+Copyright (c) 2016 Barrett Adair
+
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+*/
+
+// Code probed by test/classify.sh
+
+#ifndef CONSTEXPR_CHECKS_TEST_CLASSIFY_LEGACY_HPP
+#define CONSTEXPR_CHECKS_TEST_CLASSIFY_LEGACY_HPP
+
+namespace legacy {
+
+    struct add {
+        constexpr int operator()(int a, int b) const { return a + b; }
+    };
+
+    struct log {
+        int operator()(int a) const { return a; }
+    };
+
+    // The deduced return type is not SFINAE-friendly: asking
+    // is_constexpr_invokable about an argument without a size() member
+    // is a hard error.
+    struct size_of {
+        template<typename T>
+        constexpr auto operator()(const T& t) const { return t.size(); }
+    };
+
+    constexpr int twice(int i) { return 2 * i; }
+}
+
+#endif //#ifndef CONSTEXPR_CHECKS_TEST_CLASSIFY_LEGACY_HPP
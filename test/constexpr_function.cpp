@@ -0,0 +1,158 @@
+/*!
+Copyright (c) 2016 Barrett Adair
+
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+*/
+
+#include <type_traits>
+#include "constexpr_checks/function.hpp"
+
+#ifndef CC_ASSERT
+#define CC_ASSERT(...) static_assert(__VA_ARGS__, #__VA_ARGS__)
+#endif //CC_ASSERT
+
+using constexpr_checks::constexpr_function;
+using constexpr_checks::constexpr_function_ref;
+
+constexpr int twice(int i) { return i * 2; }
+int thrice(int i) { return i * 3; }
+
+using twice_c = std::integral_constant<decltype(&twice), &twice>;
+using thrice_c = std::integral_constant<decltype(&thrice), &thrice>;
+
+struct negate {
+    constexpr int operator()(int i) const { return -i; }
+};
+
+struct runtime_negate {
+    int operator()(int i) const { return -i; }
+};
+
+struct offset {
+    int by;
+    constexpr int operator()(int i) const { return i + by; }
+};
+
+// not trivially copyable, so it cannot be stored in the buffer
+struct counted {
+    int* copies;
+    counted(const counted& other) : copies(other.copies) { ++*copies; }
+    int operator()(int i) const { return i; }
+};
+
+struct big {
+    long long a, b, c, d, e;
+    constexpr long long operator()(int i) const { return a + b + c + d + e + i; }
+};
+
+using fn = constexpr_function<int(int)>;
+using fn_ref = constexpr_function_ref<int(int)>;
+
+namespace test1 {
+
+    // no heap, no virtual functions, and cheap to copy
+    CC_ASSERT(std::is_trivially_copyable<fn>::value);
+    CC_ASSERT(std::is_trivially_destructible<fn>::value);
+    CC_ASSERT(!std::is_polymorphic<fn>::value);
+    CC_ASSERT(std::is_trivially_copyable<fn_ref>::value);
+
+    CC_ASSERT(fn::is_constexpr_target<twice_c>());
+    CC_ASSERT(fn::is_constexpr_target<negate>());
+    CC_ASSERT(!fn::is_constexpr_target<thrice_c>());
+    CC_ASSERT(!fn::is_constexpr_target<runtime_negate>());
+    CC_ASSERT(!fn::is_constexpr_target<offset>());
+    CC_ASSERT(!fn::is_constexpr_target<int(*)(int)>());
+
+    CC_ASSERT(fn_ref::is_constexpr_target<twice_c>());
+    CC_ASSERT(fn_ref::is_constexpr_target<negate>());
+    CC_ASSERT(!fn_ref::is_constexpr_target<offset>());
+
+    CC_ASSERT(std::is_constructible<fn, negate>::value);
+    CC_ASSERT(!std::is_constructible<fn, int>::value);
+    CC_ASSERT(!std::is_constructible<fn, int(*)(int, int)>::value);
+    CC_ASSERT(!std::is_constructible<fn_ref, int>::value);
+    CC_ASSERT(!std::is_constructible<fn, counted>::value);
+    CC_ASSERT(std::is_constructible<fn_ref, counted&>::value);
+}
+
+namespace test2 {
+
+    // constant evaluation through the erased call
+    constexpr fn a = twice_c{};
+    constexpr fn b = negate{};
+    constexpr fn c = &twice;
+    constexpr fn d{};
+    constexpr fn e = b;
+
+    CC_ASSERT(a(3) == 6);
+    CC_ASSERT(b(3) == -3);
+    CC_ASSERT(c(3) == 6);
+    CC_ASSERT(e(3) == -3);
+    CC_ASSERT(a && b && c && !d);
+
+    constexpr fn_ref f = twice_c{};
+    constexpr fn_ref g = negate{};
+    constexpr fn_ref h = &twice;
+
+    CC_ASSERT(f(4) == 8);
+    CC_ASSERT(g(4) == -4);
+    CC_ASSERT(h(4) == 8);
+}
+
+#if defined(__cpp_constexpr) && __cpp_constexpr >= 201603
+
+namespace test3 {
+
+    // capture-less lambdas are implicitly constexpr since C++17
+    constexpr auto square = [](int i) { return i * i; };
+
+    CC_ASSERT(fn::is_constexpr_target<decltype(square)>());
+    CC_ASSERT(fn_ref::is_constexpr_target<decltype(square)>());
+
+    constexpr fn a = square;
+    constexpr fn_ref b = square;
+    CC_ASSERT(a(5) == 25);
+    CC_ASSERT(b(5) == 25);
+}
+
+#endif
+
+int main() {
+
+    int result = 0;
+
+    // stateful, converted and runtime-only targets
+    fn a = offset{ 10 };
+    fn b = thrice_c{};
+    fn c = runtime_negate{};
+    constexpr_function<long long(int), sizeof(big)> d = big{ 1, 2, 3, 4, 5 };
+    constexpr_function<long(long)> e = &twice;
+    constexpr_function<void(int)> f = negate{};
+
+    result |= a(1) != 11;
+    result |= b(1) != 3;
+    result |= c(1) != -1;
+    result |= d(1) != 16;
+    result |= e(2) != 4;
+    f(1);
+
+    fn g = a;
+    a = &thrice;
+    result |= g(1) != 11;
+    result |= a(2) != 6;
+
+    int total = 0;
+    auto accumulate = [&total](int i) { total += i; return total; };
+    fn_ref h = accumulate;
+    h(2);
+    h(3);
+    result |= total != 5;
+
+    offset o{ 7 };
+    fn_ref i = o;
+    o.by = 8;
+    result |= i(1) != 9;
+
+    return result;
+}
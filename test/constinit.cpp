@@ -0,0 +1,100 @@
+/*!
+Copyright (c) 2016 Barrett Adair
+
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+*/
+
+#include <type_traits>
+#include "constexpr_checks/constinit.hpp"
+
+#ifndef CC_ASSERT
+#define CC_ASSERT(...) static_assert(__VA_ARGS__, #__VA_ARGS__)
+#endif //CC_ASSERT
+
+using constexpr_checks::is_constant_initializable;
+using constexpr_checks::is_guard_free;
+
+template<int I>
+using int_ = std::integral_constant<int, I>;
+
+namespace test1 {
+
+    struct counter {
+        int count = 0;
+        constexpr counter() = default;
+        constexpr explicit counter(int i) : count(i) {}
+    };
+
+    struct arena {
+        char* begin;
+        char* end;
+    };
+
+    CC_ASSERT(is_constant_initializable<counter>());
+    CC_ASSERT(is_constant_initializable<counter, int>());
+    CC_ASSERT(is_constant_initializable<counter, int_<3>>());
+    CC_ASSERT(!is_constant_initializable<counter, int, int>());
+    CC_ASSERT(is_guard_free<counter, int>());
+
+    CC_ASSERT(is_constant_initializable<arena>());
+    CC_ASSERT(is_constant_initializable<arena, char*, char*>());
+    CC_ASSERT(is_constant_initializable<int, int_<1>>());
+}
+
+namespace test2 {
+
+    int next_id() { return 1; }
+
+    struct registered {
+        int id;
+        registered() : id(next_id()) {}
+    };
+
+    struct checked {
+        int value;
+        constexpr explicit checked(int i) : value(i > 0 ? i : throw 0) {}
+    };
+
+    struct owner {
+        int* p = nullptr;
+        constexpr owner() = default;
+        ~owner() {}
+    };
+
+    CC_ASSERT(!is_constant_initializable<registered>());
+    CC_ASSERT(!is_guard_free<registered>());
+
+    // constexpr, but not for every value
+    CC_ASSERT(!is_constant_initializable<checked, int>());
+    CC_ASSERT(is_constant_initializable<checked, int_<1>>());
+
+    // a non-trivial destructor still needs a guard
+    CC_ASSERT(!is_guard_free<owner>());
+}
+
+namespace test3 {
+
+    thread_local CONSTEXPR_CHECKS_CONSTINIT_VARIABLE(test1::counter, hits, 5);
+
+    static CONSTEXPR_CHECKS_CONSTINIT_VARIABLE(test1::arena, arena,
+        nullptr, nullptr);
+
+    int bump() {
+        static CONSTEXPR_CHECKS_CONSTINIT_DEFAULT(test1::counter, calls);
+        return ++calls.count;
+    }
+}
+
+int main() {
+
+    using namespace test3;
+
+    if (hits.count != 5 || arena.begin != nullptr)
+        return 1;
+
+    ++hits.count;
+    bump();
+
+    return hits.count == 6 && bump() == 2 ? 0 : 1;
+}
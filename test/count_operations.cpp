@@ -0,0 +1,174 @@
+/*!
+Copyright (c) 2016 Barrett Adair
+
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+*/
+
+#include <type_traits>
+#include "constexpr_checks.hpp"
+
+#ifndef CC_ASSERT
+#define CC_ASSERT(...) static_assert(__VA_ARGS__, #__VA_ARGS__)
+#endif //CC_ASSERT
+
+using constexpr_checks::count_operations;
+using constexpr_checks::operation;
+
+namespace test1 {
+
+    // mirrors 'subtract' in example/is_constexpr_function_object.cpp
+    struct subtract {
+        template<typename T1, typename T2>
+        constexpr auto operator()(T1, T2) const {
+            return T1{} - T2{};
+        }
+    };
+
+    constexpr auto c = count_operations<subtract>();
+    CC_ASSERT(c.valid);
+    CC_ASSERT(c[operation::subtract] == 1);
+    CC_ASSERT(c.total() == 1);
+    CC_ASSERT(count_operations(subtract{}).total() == 1);
+}
+
+namespace test2 {
+
+    // a*x*x + b*x + c
+    struct polynomial {
+        template<typename A, typename B, typename C, typename X>
+        constexpr auto operator()(A a, B b, C c, X x) const {
+            return a * x * x + b * x + c;
+        }
+    };
+
+    constexpr auto c = count_operations<polynomial>();
+    CC_ASSERT(c.valid);
+    CC_ASSERT(c[operation::multiply] == 3);
+    CC_ASSERT(c[operation::add] == 2);
+    CC_ASSERT(c.total() == 5);
+}
+
+namespace test3 {
+
+    // counts follow assignments between statements
+    struct accumulate {
+        template<typename T>
+        constexpr auto operator()(T t) const {
+            T result = t;
+            result = result * t;
+            result = result + t;
+            return -result;
+        }
+    };
+
+    constexpr auto c = count_operations<accumulate>();
+    CC_ASSERT(c.valid);
+    CC_ASSERT(c[operation::multiply] == 1);
+    CC_ASSERT(c[operation::add] == 1);
+    CC_ASSERT(c[operation::assign] == 2);
+    CC_ASSERT(c[operation::negate] == 1);
+    CC_ASSERT(c.total() == 5);
+}
+
+namespace test4 {
+
+    struct compare {
+        template<typename T1, typename T2>
+        constexpr auto operator()(T1 t1, T2 t2) const {
+            return (t1 < t2) || !(t1 == t2 << 1);
+        }
+    };
+
+    constexpr auto c = count_operations<compare>();
+    CC_ASSERT(c.valid);
+    CC_ASSERT(c[operation::less] == 1);
+    CC_ASSERT(c[operation::equal] == 1);
+    CC_ASSERT(c[operation::left_shift] == 1);
+    CC_ASSERT(c[operation::logical_not] == 1);
+    CC_ASSERT(c[operation::logical_or] == 1);
+    CC_ASSERT(c.total() == 5);
+}
+
+namespace test5 {
+
+    // not constexpr
+    struct add {
+        template<typename T1, typename T2>
+        auto operator()(T1 t1, T2 t2) const {
+            return t1 + t2;
+        }
+    };
+
+    // the result is not the probe, so the counts are lost
+    struct to_int {
+        template<typename T>
+        constexpr int operator()(T t) const {
+            return t + t;
+        }
+    };
+
+    // no operations
+    struct zero {
+        constexpr int operator()() const { return 0; }
+    };
+
+    CC_ASSERT(!count_operations<add>().valid);
+    CC_ASSERT(!count_operations<to_int>().valid);
+    CC_ASSERT(!count_operations<zero>().valid);
+    CC_ASSERT(count_operations<add>().total() == 0);
+}
+
+namespace test6 {
+
+    template<typename T>
+    constexpr T cube(T t) { return t * t * t; }
+
+    // templated function pointers are probed with their parameter types
+    // rather than the worm, so only generic callables are counted
+    using F = std::integral_constant<decltype(&cube<int>), &cube<int>>;
+    CC_ASSERT(!count_operations<F>().valid);
+}
+
+namespace test7 {
+
+    // compound assignments and increments update the worm in place
+    struct mix {
+        template<typename T1, typename T2>
+        constexpr auto operator()(T1 t1, T2 t2) const {
+            T1 result = t1 ^ t2;
+            result += t2;
+            ++result;
+            result++;
+            return result;
+        }
+    };
+
+    constexpr auto c = count_operations<mix>();
+    CC_ASSERT(c.valid);
+    CC_ASSERT(c[operation::bitwise_xor] == 1);
+    CC_ASSERT(c[operation::add_assign] == 1);
+    CC_ASSERT(c[operation::increment] == 2);
+    CC_ASSERT(c[operation::assign] == 0);
+    CC_ASSERT(c.total() == 4);
+}
+
+namespace test8 {
+
+    struct in_range {
+        template<typename T1, typename T2, typename T3>
+        constexpr auto operator()(T1 t, T2 lo, T3 hi) const {
+            return lo <= t[0] && t[0] >= hi;
+        }
+    };
+
+    constexpr auto c = count_operations<in_range>();
+    CC_ASSERT(c.valid);
+    CC_ASSERT(c[operation::less_equal] == 1);
+    CC_ASSERT(c[operation::greater_equal] == 1);
+    CC_ASSERT(c[operation::subscript] == 2);
+    CC_ASSERT(c[operation::logical_and] == 1);
+    CC_ASSERT(c.total() == 5);
+}
+
+int main() {}
@@ -0,0 +1,97 @@
+/*!
+Copyright (c) 2016 Barrett Adair
+
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+*/
+
+#include <type_traits>
+#include <stdexcept>
+#include <string_view>
+#include "constexpr_checks/fixed_string.hpp"
+
+#ifndef CC_ASSERT
+#define CC_ASSERT(...) static_assert(__VA_ARGS__, #__VA_ARGS__)
+#endif //CC_ASSERT
+
+#if defined(__cpp_nontype_template_args) \
+    && __cpp_nontype_template_args >= 201911L
+
+using constexpr_checks::constexpr_fold;
+using constexpr_checks::fixed_array;
+using constexpr_checks::fixed_string;
+using constexpr_checks::is_constexpr_invokable;
+using constexpr_checks::literal;
+using constexpr_checks::string_literal;
+
+namespace test1 {
+
+    constexpr fixed_string s = "route";
+    CC_ASSERT(s.size() == 5);
+    CC_ASSERT(s[0] == 'r' && s[4] == 'e');
+    CC_ASSERT(std::string_view(s) == "route");
+    CC_ASSERT(s == fixed_string("route"));
+
+    constexpr fixed_array a{1, 2, 3};
+    CC_ASSERT(std::is_same<decltype(a), const fixed_array<int, 3>>::value);
+    CC_ASSERT(a.size() == 3 && a[2] == 3);
+}
+
+namespace test2 {
+
+    struct parse_int {
+        constexpr int operator()(std::string_view s) const {
+            if (s.empty())
+                throw std::invalid_argument("empty");
+            int result = 0;
+            for (char c : s) {
+                if (c < '0' || c > '9')
+                    throw std::invalid_argument("not a digit");
+                result = result * 10 + (c - '0');
+            }
+            return result;
+        }
+    };
+
+    // make_constexpr can only pass an empty string_view
+    CC_ASSERT(!is_constexpr_invokable<parse_int, std::string_view>());
+
+    CC_ASSERT(is_constexpr_invokable<parse_int, string_literal<"123">>());
+    CC_ASSERT(!is_constexpr_invokable<parse_int, string_literal<"12x">>());
+    CC_ASSERT(is_constexpr_invokable(parse_int{}, string_literal<"7">{}));
+
+    CC_ASSERT(constexpr_fold<parse_int, string_literal<"123">>() == 123);
+}
+
+namespace test3 {
+
+    // conversions don't take part in template argument deduction, so
+    // the parameter type is spelled out
+    struct sum {
+        constexpr int operator()(const fixed_array<int, 3>& a) const {
+            int result = 0;
+            for (int t : a)
+                result += t;
+            return result;
+        }
+    };
+
+    constexpr int get(const fixed_array<int, 3>& a, std::size_t i) {
+        return a[i];
+    }
+
+    using get_c = std::integral_constant<decltype(&get), &get>;
+    using values = literal<fixed_array{1, 2, 3}>;
+
+    CC_ASSERT(constexpr_fold<sum, values>() == 6);
+    CC_ASSERT(is_constexpr_invokable<get_c, values,
+        std::integral_constant<std::size_t, 2>>());
+    CC_ASSERT(!is_constexpr_invokable<get_c, values,
+        std::integral_constant<std::size_t, 3>>());
+    CC_ASSERT(constexpr_fold<get_c, values,
+        std::integral_constant<std::size_t, 1>>() == 2);
+}
+
+#endif
+
+int main() {}
@@ -0,0 +1,82 @@
+#!/bin/sh
+# Copyright Barrett Adair 2016
+# Distributed under the Boost Software License, Version 1.0.
+# (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+#
+# Checks that the check machinery has no runtime or binary footprint.
+# Each example and each compile-time test is compiled with optimization,
+# and the resulting object must have:
+#
+#   - no symbols from namespace constexpr_checks (nm), and
+#   - for the examples, which have no runtime data of their own, no
+#     .rodata or .data.rel.ro sections (size).
+#
+# Every example is also linked against a second translation unit that
+# includes every header. That link fails if a header defines a
+# non-inline variable.
+#
+# Usage, from the repository root:
+#
+#   CXX=g++ CXXFLAGS="-std=c++14 -I/path/to/callable_traits/include" \
+#       sh test/footprint.sh
+
+CXX=${CXX:-c++}
+CXXFLAGS=${CXXFLAGS:--std=c++14}
+OPT=${OPT:--O2}
+
+# tests whose runtime facilities (parallel algorithms, type-erased
+# functions, dispatch tables, ...) are meant to emit code are excluded
+COMPILE_TIME_TESTS="
+    test/count_operations.cpp
+    test/is_constexpr.cpp
+    test/is_constexpr_auto.cpp
+    test/is_constexpr_invokable.cpp
+    test/is_constexpr_lambda.cpp
+    test/is_constexpr_seeded.cpp
+    test/lift.cpp
+    test/make_constexpr.cpp
+"
+
+tmp=$(mktemp -d) || exit 1
+trap 'rm -rf "$tmp"' EXIT
+status=0
+
+fail() {
+    echo "footprint: $*" >&2
+    status=1
+}
+
+# leaves the object in $tmp/object.o
+compile() {
+    $CXX $CXXFLAGS $OPT -I. -c "$1" -o "$tmp/object.o" ||
+        { fail "$1: does not compile"; return 1; }
+}
+
+check_symbols() {
+    symbols=$(nm -C "$tmp/object.o" | grep 'constexpr_checks::')
+    [ -z "$symbols" ] || fail "$1: emits library symbols:
+$symbols"
+}
+
+for header in constexpr_checks.hpp constexpr_checks/*.hpp; do
+    echo "#include \"$header\""
+done > "$tmp/all_headers.cpp"
+
+$CXX $CXXFLAGS $OPT -I. -c "$tmp/all_headers.cpp" -o "$tmp/all_headers.o" ||
+    { fail "headers do not compile"; exit 1; }
+
+for example in example/*.cpp; do
+    compile "$example" || continue
+    check_symbols "$example"
+    data=$(size -A "$tmp/object.o" | grep -E '^\.(rodata|data\.rel\.ro)')
+    [ -z "$data" ] || fail "$example: emits read-only data:
+$data"
+    $CXX "$tmp/object.o" "$tmp/all_headers.o" -o "$tmp/program" ||
+        fail "$example: does not link with a second translation unit"
+done
+
+for test in $COMPILE_TIME_TESTS; do
+    compile "$test" && check_symbols "$test"
+done
+
+exit $status
@@ -164,4 +164,108 @@ namespace test7 {
     CC_ASSERT(!is_constexpr<G3>());
 }
 
+namespace test8 {
+
+    // every overloadable operator on the probe arguments
+
+    struct compound_assignment {
+        template<typename T>
+        constexpr auto operator()(T t) const {
+            T acc = t;
+            acc += t;
+            acc -= t;
+            acc *= t;
+            acc /= t;
+            acc %= t;
+            acc &= t;
+            acc |= t;
+            acc ^= t;
+            acc <<= t;
+            acc >>= t;
+            return acc;
+        }
+    };
+
+    struct increment {
+        template<typename T>
+        constexpr auto operator()(T t) const {
+            ++t;
+            t++;
+            --t;
+            t--;
+            return t;
+        }
+    };
+
+    struct subscript {
+        template<typename T, typename U>
+        constexpr auto operator()(T t, U u) const {
+            return t[0] + t[u];
+        }
+    };
+
+    struct member_access {
+        template<typename T, typename U>
+        constexpr auto operator()(T t, U u) const {
+            return t.operator->() ? t->*u : t->*u;
+        }
+    };
+
+    struct comparison {
+        template<typename T, typename U>
+        constexpr auto operator()(T t, U u) const {
+            return (t <= u) && (t >= u) && (t <= 1) && (1 >= u);
+        }
+    };
+
+    struct exclusive_or {
+        template<typename T, typename U>
+        constexpr auto operator()(T t, U u) const {
+            return t ^ u ^ 1;
+        }
+    };
+
+    // the same accumulate-style kernel, which is not constexpr
+    struct runtime_increment {
+        template<typename T>
+        auto operator()(T t) const {
+            ++t;
+            return t;
+        }
+    };
+
+    CC_ASSERT(is_constexpr(compound_assignment{}));
+    CC_ASSERT(is_constexpr<compound_assignment>());
+    CC_ASSERT(is_constexpr(increment{}));
+    CC_ASSERT(is_constexpr<increment>());
+    CC_ASSERT(is_constexpr(subscript{}));
+    CC_ASSERT(is_constexpr<subscript>());
+    CC_ASSERT(is_constexpr(member_access{}));
+    CC_ASSERT(is_constexpr<member_access>());
+    CC_ASSERT(is_constexpr(comparison{}));
+    CC_ASSERT(is_constexpr<comparison>());
+    CC_ASSERT(is_constexpr(exclusive_or{}));
+    CC_ASSERT(is_constexpr<exclusive_or>());
+
+    CC_ASSERT(!is_constexpr(runtime_increment{}));
+    CC_ASSERT(!is_constexpr<runtime_increment>());
+}
+
+#ifdef __cpp_impl_three_way_comparison
+
+namespace test9 {
+
+    struct three_way {
+        template<typename T, typename U>
+        constexpr auto operator()(T t, U u) const {
+            return (t <=> u) < 0 || (t <=> 1) == 0;
+        }
+    };
+
+    CC_ASSERT(is_constexpr(three_way{}));
+    CC_ASSERT(is_constexpr<three_way>());
+}
+
+#endif //#ifdef __cpp_impl_three_way_comparison
+
 int main() {}
@@ -0,0 +1,96 @@
+/*!
+Copyright (c) 2016 Barrett Adair
+
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+*/
+
+#include <type_traits>
+#include "constexpr_checks.hpp"
+
+#ifndef CC_ASSERT
+#define CC_ASSERT(...) static_assert(__VA_ARGS__, #__VA_ARGS__)
+#endif //CC_ASSERT
+
+#ifdef __cpp_nontype_template_parameter_auto
+
+using constexpr_checks::is_constexpr;
+using constexpr_checks::is_constexpr_invokable;
+
+namespace test1 {
+
+    constexpr int foo(const int&) { return 1; }
+    int bar(const int&) { return 1; }
+    constexpr int baz() { return 1; }
+    constexpr int qux(int, char, long) { return 1; }
+
+    CC_ASSERT(is_constexpr<&foo>());
+    CC_ASSERT(is_constexpr<foo>());
+    CC_ASSERT(!is_constexpr<&bar>());
+    CC_ASSERT(is_constexpr<&baz>());
+    CC_ASSERT(is_constexpr<&qux>());
+
+    CC_ASSERT(is_constexpr_invokable<&foo, int>());
+    CC_ASSERT(!is_constexpr_invokable<&foo>());
+    CC_ASSERT(!is_constexpr_invokable<&foo, int, int>());
+    CC_ASSERT(!is_constexpr_invokable<&foo, int*>());
+    CC_ASSERT(!is_constexpr_invokable<&bar, int>());
+    CC_ASSERT(is_constexpr_invokable<&baz>());
+    CC_ASSERT(is_constexpr_invokable<&qux, int, int, int>());
+
+    // agrees with the std::integral_constant syntax
+    using D = std::integral_constant<decltype(&foo), &foo>;
+    CC_ASSERT(is_constexpr<&foo>() == is_constexpr<D>());
+    CC_ASSERT(is_constexpr_invokable<&foo, int>()
+        == is_constexpr_invokable<D, int>());
+}
+
+namespace test2 {
+
+    struct foo {
+        constexpr int bar(int) const { return 1; }
+        int baz(int) const { return 1; }
+        constexpr int qux() && { return 1; }
+        int value;
+        static constexpr int static_value = 1;
+    };
+
+    CC_ASSERT(is_constexpr<&foo::bar>());
+    CC_ASSERT(!is_constexpr<&foo::baz>());
+    CC_ASSERT(is_constexpr<&foo::qux>());
+
+    // not member functions
+    CC_ASSERT(!is_constexpr<&foo::value>());
+    CC_ASSERT(!is_constexpr<&foo::static_value>());
+
+    CC_ASSERT(is_constexpr_invokable<&foo::bar, foo&, int>());
+    CC_ASSERT(is_constexpr_invokable<&foo::bar, const foo*, int>());
+    CC_ASSERT(!is_constexpr_invokable<&foo::bar, foo&>());
+    CC_ASSERT(!is_constexpr_invokable<&foo::baz, foo&, int>());
+    CC_ASSERT(is_constexpr_invokable<&foo::qux, foo>());
+    CC_ASSERT(!is_constexpr_invokable<&foo::qux, foo&>());
+    CC_ASSERT(!is_constexpr_invokable<&foo::value, foo&>());
+}
+
+namespace test3 {
+
+    constexpr int foo(int) noexcept { return 1; }
+    int bar(int) noexcept { return 1; }
+    constexpr int baz(int, ...) { return 1; }
+
+    CC_ASSERT(is_constexpr<&foo>());
+    CC_ASSERT(!is_constexpr<&bar>());
+    CC_ASSERT(is_constexpr_invokable<&foo, int>());
+    CC_ASSERT(!is_constexpr_invokable<&bar, int>());
+
+    // C-style variadic functions take the std::integral_constant path
+    CC_ASSERT(is_constexpr_invokable<&baz, int, int>());
+
+    // not callable at all
+    CC_ASSERT(!is_constexpr<3>());
+    CC_ASSERT(!is_constexpr_invokable<3, int>());
+}
+
+#endif //#ifdef __cpp_nontype_template_parameter_auto
+
+int main() {}
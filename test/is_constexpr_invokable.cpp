@@ -77,4 +77,62 @@ CT_ASSERT(!is_constexpr_invokable<foo1_pmf, foo1&, int>());
 CT_ASSERT(!is_constexpr_invokable<foo3_pmf, foo3&>());
 CT_ASSERT(is_constexpr_invokable<foo3_pmf, foo3&, int>());
 
+struct foo5 {
+    constexpr int operator()(int) const noexcept {
+        return 1;
+    }
+    int* operator()(int*) const noexcept {
+        return nullptr;
+    }
+};
+
+struct not_literal {
+    not_literal() {}
+    ~not_literal() {}
+};
+
+struct foo6 {
+    not_literal operator()() const {
+        return {};
+    }
+};
+
+using constexpr_checks::constexpr_invoke_flags;
+
+// flags
+constexpr auto foo1_flags = constexpr_invoke_flags<foo1>();
+CT_ASSERT(foo1_flags.invokable);
+CT_ASSERT(!foo1_flags.nothrow_invokable);
+CT_ASSERT(!foo1_flags.constexpr_invokable);
+CT_ASSERT(foo1_flags.literal_result);
+
+constexpr auto foo1_int_flags = constexpr_invoke_flags<foo1, int>();
+CT_ASSERT(!foo1_int_flags.invokable);
+CT_ASSERT(!foo1_int_flags.nothrow_invokable);
+CT_ASSERT(!foo1_int_flags.constexpr_invokable);
+CT_ASSERT(!foo1_int_flags.literal_result);
+
+constexpr auto foo2_flags = constexpr_invoke_flags(foo2{}, 0);
+CT_ASSERT(foo2_flags.invokable && foo2_flags.constexpr_invokable);
+CT_ASSERT(!foo2_flags.nothrow_invokable);
+
+constexpr auto foo3_flags = constexpr_invoke_flags<foo3_pmf, foo3&, int>();
+CT_ASSERT(foo3_flags.invokable && foo3_flags.constexpr_invokable);
+CT_ASSERT(!constexpr_invoke_flags<foo3_pmf, foo3&>().invokable);
+
+constexpr auto foo4_flags = constexpr_invoke_flags(foo4{}, 0);
+CT_ASSERT(foo4_flags.invokable && foo4_flags.constexpr_invokable);
+CT_ASSERT(!constexpr_invoke_flags(foo4{}).invokable);
+
+constexpr auto foo5_flags = constexpr_invoke_flags<foo5, int>();
+CT_ASSERT(foo5_flags.invokable && foo5_flags.nothrow_invokable);
+CT_ASSERT(foo5_flags.constexpr_invokable && foo5_flags.literal_result);
+
+constexpr auto foo5_ptr_flags = constexpr_invoke_flags<foo5, int*>();
+CT_ASSERT(foo5_ptr_flags.nothrow_invokable);
+CT_ASSERT(!foo5_ptr_flags.constexpr_invokable);
+
+constexpr auto foo6_flags = constexpr_invoke_flags<foo6>();
+CT_ASSERT(foo6_flags.invokable && !foo6_flags.literal_result);
+
 int main() {}
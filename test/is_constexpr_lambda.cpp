@@ -0,0 +1,103 @@
+/*!
+Copyright (c) 2016 Barrett Adair
+
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+*/
+
+#include <type_traits>
+#include "constexpr_checks.hpp"
+
+#ifndef CC_ASSERT
+#define CC_ASSERT(...) static_assert(__VA_ARGS__, #__VA_ARGS__)
+#endif //CC_ASSERT
+
+// lambdas are implicitly constexpr since C++17
+#if defined(__cpp_constexpr) && __cpp_constexpr >= 201603
+#define CC_CONSTEXPR_LAMBDA true
+#else
+#define CC_CONSTEXPR_LAMBDA false
+#endif
+
+using constexpr_checks::is_constexpr;
+using constexpr_checks::is_constexpr_invokable;
+
+namespace test1 {
+
+    // mirrors 'zero' in example/is_constexpr_function_object.cpp
+    auto zero = [] { return 0; };
+
+    CC_ASSERT(is_constexpr(zero) == CC_CONSTEXPR_LAMBDA);
+    CC_ASSERT(is_constexpr<decltype(zero)>() == CC_CONSTEXPR_LAMBDA);
+    CC_ASSERT(is_constexpr_invokable(zero) == CC_CONSTEXPR_LAMBDA);
+    CC_ASSERT(!is_constexpr_invokable(zero, 0));
+}
+
+namespace test2 {
+
+    auto twice = [](int i) { return i * 2; };
+    auto by_ref = [](const int& i) { return i; };
+
+    CC_ASSERT(is_constexpr(twice) == CC_CONSTEXPR_LAMBDA);
+    CC_ASSERT(is_constexpr<decltype(twice)>() == CC_CONSTEXPR_LAMBDA);
+    CC_ASSERT(is_constexpr(by_ref) == CC_CONSTEXPR_LAMBDA);
+    CC_ASSERT(is_constexpr<decltype(by_ref)>() == CC_CONSTEXPR_LAMBDA);
+
+    CC_ASSERT(is_constexpr_invokable(twice, 0) == CC_CONSTEXPR_LAMBDA);
+    CC_ASSERT((is_constexpr_invokable<decltype(twice), int>()
+        == CC_CONSTEXPR_LAMBDA));
+    CC_ASSERT(!is_constexpr_invokable(twice, nullptr));
+    CC_ASSERT(!is_constexpr_invokable(twice));
+}
+
+namespace test3 {
+
+    // mirrors 'subtract' in example/is_constexpr_function_object.cpp.
+    // Generic lambdas have no function pointer conversion to probe
+    // without knowing the argument types, so they can only be checked
+    // where closure types are default constructible.
+    auto subtract = [](auto t1, auto t2) {
+        return decltype(t1){} - decltype(t2){};
+    };
+
+    // closure types are default constructible since C++20
+    constexpr bool is_default_constructible =
+        std::is_default_constructible<decltype(subtract)>::value;
+
+    CC_ASSERT(is_constexpr(subtract) == is_default_constructible);
+    CC_ASSERT(is_constexpr<decltype(subtract)>() == is_default_constructible);
+}
+
+namespace test4 {
+
+    // mirrors 'add' in example/is_constexpr_function_object.cpp -
+    // a static local can never appear in a constant expression
+    auto add = [](int i, int j) {
+        static int calls = 0;
+        ++calls;
+        return i + j;
+    };
+
+    CC_ASSERT(!is_constexpr(add));
+    CC_ASSERT(!is_constexpr<decltype(add)>());
+    CC_ASSERT(!is_constexpr_invokable(add, 1, 2));
+}
+
+namespace test5 {
+
+    // mirrors 'divide' in example/is_constexpr_function_object.cpp -
+    // a capturing lambda is neither empty nor default constructible
+
+    constexpr int zero = 0;
+
+    int i = 1;
+    auto divide = [&r = i](int j) { return j / r; };
+    auto shift = [j = zero](int k) { return k << j; };
+
+    CC_ASSERT(!is_constexpr(divide));
+    CC_ASSERT(!is_constexpr<decltype(divide)>());
+    CC_ASSERT(!is_constexpr(shift));
+    CC_ASSERT(!is_constexpr<decltype(shift)>());
+}
+
+int main() {}
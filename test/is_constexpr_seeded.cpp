@@ -0,0 +1,102 @@
+/*!
+Copyright (c) 2016 Barrett Adair
+
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+*/
+
+#include <climits>
+#include <type_traits>
+#include "constexpr_checks.hpp"
+
+#ifndef CC_ASSERT
+#define CC_ASSERT(...) static_assert(__VA_ARGS__, #__VA_ARGS__)
+#endif //CC_ASSERT
+
+using constexpr_checks::is_constexpr;
+using constexpr_checks::is_constexpr_seeded;
+
+template<int I>
+using int_ = std::integral_constant<int, I>;
+
+namespace test1 {
+
+    struct divide {
+        template<typename T1, typename T2>
+        constexpr auto operator()(T1 t1, T2 t2) const {
+            return t1 / t2;
+        }
+    };
+
+    // the plain worm can't see the divisor
+    CC_ASSERT(is_constexpr<divide>());
+
+    CC_ASSERT(is_constexpr_seeded<divide, int_<6>, int_<3>>());
+    CC_ASSERT(!is_constexpr_seeded<divide, int_<1>, int_<0>>());
+    CC_ASSERT(is_constexpr_seeded<int_<6>, int_<3>>(divide{}));
+    CC_ASSERT(!is_constexpr_seeded<int_<1>, int_<0>>(divide{}));
+}
+
+namespace test2 {
+
+    struct increment {
+        template<typename T>
+        constexpr auto operator()(T t) const {
+            t += 1;
+            return t + 1;
+        }
+    };
+
+    CC_ASSERT(is_constexpr_seeded<increment, int_<1>>());
+    CC_ASSERT(!is_constexpr_seeded<increment, int_<INT_MAX - 1>>());
+    CC_ASSERT(!is_constexpr_seeded<increment, int_<INT_MAX>>());
+}
+
+namespace test3 {
+
+    struct lookup {
+        template<typename T>
+        constexpr int operator()(T i) const {
+            constexpr int table[] = {1, 2, 3, 4};
+            return table[i];
+        }
+    };
+
+    CC_ASSERT(is_constexpr_seeded<lookup, int_<0>>());
+    CC_ASSERT(is_constexpr_seeded<lookup, int_<3>>());
+    CC_ASSERT(!is_constexpr_seeded<lookup, int_<4>>());
+    CC_ASSERT(!is_constexpr_seeded<lookup, int_<-1>>());
+}
+
+namespace test4 {
+
+    struct clamp {
+        template<typename T, typename Lo, typename Hi>
+        constexpr auto operator()(T t, Lo lo, Hi hi) const {
+            return t < lo ? lo : (hi < t ? hi : t);
+        }
+    };
+
+    CC_ASSERT(is_constexpr_seeded<clamp, int_<5>, int_<0>, int_<10>>());
+
+    struct not_constexpr {
+        template<typename T>
+        auto operator()(T t) const { return t; }
+    };
+
+    CC_ASSERT(!is_constexpr_seeded<not_constexpr, int_<0>>());
+}
+
+#ifdef __cpp_nontype_template_parameter_auto
+
+namespace test5 {
+
+    using constexpr_checks::seed;
+
+    CC_ASSERT(is_constexpr_seeded<test1::divide, seed<10L>, seed<'\x02'>>());
+    CC_ASSERT(!is_constexpr_seeded<test1::divide, seed<10L>, seed<0L>>());
+}
+
+#endif //#ifdef __cpp_nontype_template_parameter_auto
+
+int main() {}
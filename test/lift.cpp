@@ -0,0 +1,88 @@
+/*!
+Copyright (c) 2016 Barrett Adair
+
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+*/
+
+#include <type_traits>
+#include <utility>
+#include "constexpr_checks.hpp"
+
+#ifndef CC_ASSERT
+#define CC_ASSERT(...) static_assert(__VA_ARGS__, #__VA_ARGS__)
+#endif //CC_ASSERT
+
+using constexpr_checks::is_constexpr;
+using constexpr_checks::is_constexpr_invokable;
+
+namespace test1 {
+
+    // an overload set with one constexpr member
+    constexpr int twice(int i) { return i * 2; }
+    double twice(double d) { return d * 2; }
+    long twice(long l, long) { return l * 2; }
+
+    CONSTEXPR_CHECKS_DEFINE_LIFTED(twice_fn, twice);
+
+    CC_ASSERT(is_constexpr_invokable<twice_fn, int>());
+    CC_ASSERT(!is_constexpr_invokable<twice_fn, double>());
+    CC_ASSERT(!is_constexpr_invokable<twice_fn, long, long>());
+
+    // no overload
+    CC_ASSERT(!is_constexpr_invokable<twice_fn, int*>());
+
+    // ambiguous for the template worm
+    CC_ASSERT(!is_constexpr<twice_fn>());
+
+    CC_ASSERT(noexcept(twice_fn{}(1)) == noexcept(twice(1)));
+    CC_ASSERT(twice_fn{}(21) == 42);
+}
+
+namespace test2 {
+
+    template<typename T>
+    constexpr T square(T t) { return t * t; }
+
+    CONSTEXPR_CHECKS_DEFINE_LIFTED(square_fn, square);
+    CONSTEXPR_CHECKS_DEFINE_LIFTED(square_long, square<long>);
+
+    CC_ASSERT(is_constexpr<square_fn>());
+    CC_ASSERT(is_constexpr_invokable<square_fn, int>());
+    CC_ASSERT(is_constexpr_invokable<square_long, int>());
+    CC_ASSERT(std::is_same<decltype(square_long{}(1)), long>::value);
+    CC_ASSERT(square_fn{}(3) == 9);
+}
+
+namespace test3 {
+
+    struct wrapper { int i; };
+
+    constexpr int get(wrapper w) { return w.i; }
+
+    // declared after the lifted type; only found through ADL
+    CONSTEXPR_CHECKS_DEFINE_LIFTED(get_fn, get);
+
+    constexpr int get(int i) { return i; }
+
+    CC_ASSERT(is_constexpr_invokable<get_fn, wrapper>());
+    CC_ASSERT(!is_constexpr_invokable<get_fn, int>());
+}
+
+// closure types are default constructible since C++20
+#if __cplusplus > 201703L
+
+namespace test4 {
+
+    constexpr auto twice = CONSTEXPR_CHECKS_LIFT(test1::twice);
+    constexpr auto square = CONSTEXPR_CHECKS_LIFT(test2::square);
+
+    CC_ASSERT(is_constexpr_invokable(twice, 1));
+    CC_ASSERT(!is_constexpr_invokable(twice, 1.0));
+    CC_ASSERT(is_constexpr(square));
+    CC_ASSERT(square(4) == 16);
+}
+
+#endif //#if __cplusplus > 201703L
+
+int main() {}
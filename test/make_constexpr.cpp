@@ -91,4 +91,52 @@ CC_ASSERT(12 == CONSTEXPR_CHECKS_MAKE_CONSTEXPR(const foo)(CONSTEXPR_CHECKS_MAKE
 CC_ASSERT(12 == CONSTEXPR_CHECKS_MAKE_CONSTEXPR(const foo&&)(CONSTEXPR_CHECKS_MAKE_CONSTEXPR(int)));
 CC_ASSERT(12 == CONSTEXPR_CHECKS_MAKE_CONSTEXPR(const foo)(CONSTEXPR_CHECKS_MAKE_CONSTEXPR(int)));
 
+using constexpr_checks::constexpr_qualifier_matrix;
+using constexpr_checks::qualifier_bit;
+using constexpr_checks::ref_qualifier;
+
+// every overload of foo is constexpr, so every bit is set
+CC_ASSERT(0xFFFF == constexpr_qualifier_matrix<foo, int>());
+CC_ASSERT(0xFFFF == constexpr_qualifier_matrix<const foo&, int&&>());
+CC_ASSERT(0 == constexpr_qualifier_matrix<foo>());
+CC_ASSERT(0 == constexpr_qualifier_matrix<foo, int, int>());
+
+struct bar {
+
+    constexpr int operator()(int&&) && {
+        return 1;
+    }
+
+    int operator()(int&&) const && {
+        return 2;
+    }
+
+    constexpr int operator()(const int&) const & {
+        return 3;
+    }
+};
+
+constexpr unsigned bar_mask = constexpr_qualifier_matrix<bar, int>();
+
+// bar&& picks the non-const rvalue overload for rvalue arguments
+CC_ASSERT(bar_mask & qualifier_bit(ref_qualifier::rvalue, ref_qualifier::rvalue));
+
+// ...and falls back to the const& overload for everything else
+CC_ASSERT(bar_mask & qualifier_bit(ref_qualifier::rvalue, ref_qualifier::lvalue));
+CC_ASSERT(bar_mask & qualifier_bit(ref_qualifier::lvalue, ref_qualifier::lvalue));
+CC_ASSERT(bar_mask & qualifier_bit(ref_qualifier::lvalue, ref_qualifier::const_rvalue));
+CC_ASSERT(bar_mask & qualifier_bit(ref_qualifier::const_lvalue, ref_qualifier::rvalue));
+
+// const bar&& picks the non-constexpr overload for rvalue arguments
+CC_ASSERT(!(bar_mask & qualifier_bit(ref_qualifier::const_rvalue, ref_qualifier::rvalue)));
+CC_ASSERT(bar_mask & qualifier_bit(ref_qualifier::const_rvalue, ref_qualifier::lvalue));
+
+// not a literal type
+struct baz {
+    virtual ~baz() {}
+    constexpr int operator()(int) const { return 0; }
+};
+
+CC_ASSERT(0 == constexpr_qualifier_matrix<baz, int>());
+
 int main() { return 0; }
@@ -0,0 +1,91 @@
+/*!
+Copyright (c) 2016 Barrett Adair
+
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+*/
+
+#include <type_traits>
+#include "constexpr_checks/pipeline.hpp"
+
+#ifndef CC_ASSERT
+#define CC_ASSERT(...) static_assert(__VA_ARGS__, #__VA_ARGS__)
+#endif //CC_ASSERT
+
+using constexpr_checks::pipe;
+
+template<int I>
+using int_c = std::integral_constant<int, I>;
+
+struct twice {
+    template<typename T>
+    constexpr auto operator()(T t) const -> decltype(t * 2) {
+        return t * 2;
+    }
+};
+
+struct plus_one {
+    template<typename T>
+    constexpr auto operator()(T t) const -> decltype(t + 1) {
+        return t + 1;
+    }
+};
+
+// not constexpr
+int calls = 0;
+
+struct counted {
+    int operator()(int i) const {
+        ++calls;
+        return i;
+    }
+};
+
+// stateful, so it can't be folded even though it is constexpr
+struct add {
+    int n;
+    constexpr int operator()(int i) const { return i + n; }
+};
+
+namespace test1 {
+
+    constexpr auto p = pipe(twice{}, plus_one{}, twice{});
+
+    // a stateless input folds every stage
+    CC_ASSERT(decltype(p)::folded_stages<int_c<3>>() == 3);
+    CC_ASSERT(p(int_c<3>{}) == 14);
+
+    // a runtime input folds nothing
+    CC_ASSERT(decltype(p)::folded_stages<int>() == 0);
+    CC_ASSERT(p(3) == 14);
+
+    // operator| appends stages
+    constexpr auto q = pipe(twice{}) | plus_one{} | twice{};
+    CC_ASSERT(std::is_same<decltype(p), decltype(q)>::value);
+    CC_ASSERT(q(3) == 14);
+}
+
+namespace test2 {
+
+    constexpr auto p = pipe(twice{}, counted{}, plus_one{});
+    constexpr auto q = pipe(twice{}, add{ 5 }, plus_one{});
+
+    // only the prefix before the runtime stage is folded
+    CC_ASSERT(decltype(p)::folded_stages<int_c<3>>() == 1);
+    CC_ASSERT(decltype(q)::folded_stages<int_c<3>>() == 1);
+    CC_ASSERT(q(int_c<3>{}) == 12);
+
+    CC_ASSERT(decltype(pipe(counted{}))::folded_stages<int_c<3>>() == 0);
+    CC_ASSERT(decltype(pipe())::folded_stages<int_c<3>>() == 0);
+}
+
+int main() {
+
+    constexpr auto p = pipe(twice{}, counted{}, plus_one{});
+
+    int result = 0;
+    result |= p(int_c<3>{}) != 7;
+    result |= p(3) != 7;
+    result |= calls != 2;
+    return result;
+}
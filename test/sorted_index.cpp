@@ -0,0 +1,134 @@
+/*!
+Copyright (c) 2016 Barrett Adair
+
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+*/
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <functional>
+#include <type_traits>
+#include "constexpr_checks/sorted_index.hpp"
+
+#ifndef CC_ASSERT
+#define CC_ASSERT(...) static_assert(__VA_ARGS__, #__VA_ARGS__)
+#endif //CC_ASSERT
+
+using constexpr_checks::eytzinger_index;
+using constexpr_checks::make_sorted_index;
+using constexpr_checks::static_sorted_index;
+
+namespace test1 {
+
+    constexpr int keys[] = {7, 3, 9, 1, 5, 8, 2};
+
+    constexpr auto index = make_sorted_index(keys);
+
+    // 1 2 3 5 7 8 9 in breadth-first order
+    CC_ASSERT(index[0] == 5);
+    CC_ASSERT(index[1] == 2 && index[2] == 8);
+    CC_ASSERT(index[3] == 1 && index[4] == 3);
+    CC_ASSERT(index[5] == 7 && index[6] == 9);
+
+    CC_ASSERT(index.contains(1) && index.contains(9) && index.contains(5));
+    CC_ASSERT(!index.contains(0) && !index.contains(4));
+    CC_ASSERT(!index.contains(10));
+
+    CC_ASSERT(index[index.lower_bound(4)] == 5);
+    CC_ASSERT(index[index.lower_bound(6)] == 7);
+    CC_ASSERT(index[index.lower_bound(-1)] == 1);
+    CC_ASSERT(index.lower_bound(10) == index.size());
+    CC_ASSERT(index.find(10) == index.end());
+    CC_ASSERT(*index.find(8) == 8);
+
+    constexpr auto descending =
+        make_sorted_index(keys, std::greater<>{});
+    CC_ASSERT(descending[0] == 5);
+    CC_ASSERT(descending[descending.lower_bound(4)] == 3);
+}
+
+namespace test2 {
+
+    // a map, looked up by key only
+    struct entry {
+        int key;
+        int value;
+    };
+
+    struct by_key {
+        constexpr bool operator()(const entry& a, const entry& b) const {
+            return a.key < b.key;
+        }
+        constexpr bool operator()(const entry& a, int b) const {
+            return a.key < b;
+        }
+        constexpr bool operator()(int a, const entry& b) const {
+            return a < b.key;
+        }
+    };
+
+    struct routes {
+        constexpr std::array<entry, 4> operator()() const {
+            return {{ {404, 1}, {200, 2}, {500, 3}, {301, 4} }};
+        }
+    };
+
+    using map = static_sorted_index<routes, by_key>;
+
+    CC_ASSERT(map::is_constexpr::value);
+    CC_ASSERT(map::value.find(301)->value == 4);
+    CC_ASSERT(!map::value.contains(302));
+}
+
+namespace test3 {
+
+    // not constexpr, so sorted on first use
+    struct runtime_less {
+        bool operator()(int a, int b) const { return a < b; }
+    };
+
+    struct keys {
+        constexpr std::array<int, 5> operator()() const {
+            return {{ 40, 10, 50, 20, 30 }};
+        }
+    };
+
+    using set = static_sorted_index<keys, runtime_less>;
+
+    CC_ASSERT(!set::is_constexpr::value);
+}
+
+int main() {
+
+    const auto& set = test3::set::get();
+    if (&set != &test3::set::get())
+        return 1;
+
+    for (int key : {10, 20, 30, 40, 50})
+        if (!set.contains(key))
+            return 1;
+
+    if (set.contains(25) || set[set.lower_bound(25)] != 30)
+        return 1;
+
+    // agrees with std::lower_bound for every key
+    std::array<int, 100> keys{};
+    for (std::size_t i = 0; i < keys.size(); ++i)
+        keys[i] = static_cast<int>((i * 37) % 101) * 2;
+
+    auto index = make_sorted_index(keys);
+    std::sort(keys.begin(), keys.end());
+
+    for (int key = -1; key < 205; ++key) {
+        auto it = std::lower_bound(keys.begin(), keys.end(), key);
+        std::size_t i = index.lower_bound(key);
+        if ((it == keys.end()) != (i == index.size()))
+            return 1;
+        if (it != keys.end() && *it != index[i])
+            return 1;
+    }
+
+    return &test2::map::get() == &test2::map::value ? 0 : 1;
+}
@@ -0,0 +1,163 @@
+/*!
+Copyright (c) 2016 Barrett Adair
+
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+*/
+
+#include <cstddef>
+#include <stdexcept>
+#include <type_traits>
+#include "constexpr_checks/static_config.hpp"
+
+#ifndef CC_ASSERT
+#define CC_ASSERT(...) static_assert(__VA_ARGS__, #__VA_ARGS__)
+#endif //CC_ASSERT
+
+using constexpr_checks::static_config;
+using constexpr_checks::text;
+
+namespace test1 {
+
+    constexpr char literal[] = "abc";
+    constexpr char embedded[] = { 'a', 'b', 'c' };
+
+    CC_ASSERT(text{ literal }.size() == 3);
+    CC_ASSERT(text{ embedded }.size() == 3);
+    CC_ASSERT(text{ literal } == text{ embedded });
+    CC_ASSERT(text{ literal } != text{ "abd" });
+    CC_ASSERT(text{}.empty());
+
+    CC_ASSERT(text{ "key=value" }.find('=') == 3);
+    CC_ASSERT(text{ "key=value" }.find('!') == text::npos);
+    CC_ASSERT(text{ "key=value" }.substr(4) == text{ "value" });
+    CC_ASSERT(text{ "key=value" }.substr(0, 3) == text{ "key" });
+    CC_ASSERT(text{ "key" }.substr(5).empty());
+}
+
+namespace test2 {
+
+    struct entry {
+        text key;
+        int value;
+    };
+
+    struct settings {
+        std::size_t size;
+        entry entries[8];
+
+        constexpr int operator[](text key) const {
+            for (std::size_t i = 0; i < size; ++i) {
+                if (entries[i].key == key)
+                    return entries[i].value;
+            }
+            return -1;
+        }
+    };
+
+    constexpr int parse_int(text t) {
+        int result = 0;
+        for (char c : t) {
+            if (c < '0' || c > '9')
+                throw std::invalid_argument("not a number");
+            result = result * 10 + (c - '0');
+        }
+        return result;
+    }
+
+    // one "key=value" per line
+    struct parse {
+        constexpr settings operator()(text t) const {
+            settings s{};
+            std::size_t pos = 0;
+            while (pos < t.size()) {
+                std::size_t eol = t.find('\n', pos);
+                text line = t.substr(pos, eol - pos);
+                pos = eol == text::npos ? t.size() : eol + 1;
+                if (line.empty())
+                    continue;
+                std::size_t eq = line.find('=');
+                if (eq == text::npos || s.size == 8)
+                    throw std::invalid_argument("bad line");
+                s.entries[s.size++] = entry{ line.substr(0, eq),
+                    parse_int(line.substr(eq + 1)) };
+            }
+            return s;
+        }
+    };
+
+    struct config {
+        constexpr text operator()() const {
+            return R"(workers=4
+queue_depth=128
+
+timeout_ms=2500
+)";
+        }
+    };
+
+    using parsed = static_config<config, parse>;
+
+    CC_ASSERT(parsed::is_constexpr::value);
+    CC_ASSERT(std::is_same<
+        std::remove_cv<decltype(parsed::value)>::type, settings>::value);
+    CC_ASSERT(parsed::value.size == 3);
+    CC_ASSERT(parsed::value["workers"] == 4);
+    CC_ASSERT(parsed::value["queue_depth"] == 128);
+    CC_ASSERT(parsed::value["timeout_ms"] == 2500);
+    CC_ASSERT(parsed::value["retries"] == -1);
+}
+
+namespace test3 {
+
+    // not constexpr, so parsed on first use
+    struct runtime_parse {
+        test2::settings operator()(text t) const {
+            return test2::parse{}(t);
+        }
+    };
+
+    using parsed = static_config<test2::config, runtime_parse>;
+
+    CC_ASSERT(!parsed::is_constexpr::value);
+}
+
+namespace test4 {
+
+    // rejects empty input, e.g. because a key is required
+    struct parse_required {
+        constexpr int operator()(text t) const {
+            if (t.empty())
+                throw std::invalid_argument("missing workers");
+            return test2::parse{}(t)["workers"];
+        }
+    };
+
+    struct workers {
+        constexpr text operator()() const { return "workers=4"; }
+    };
+
+    using parsed = static_config<workers, parse_required>;
+
+    CC_ASSERT(parsed::is_constexpr::value);
+    CC_ASSERT(parsed::value == 4);
+
+    // the same parser cannot parse this text during constant evaluation
+    struct malformed {
+        constexpr text operator()() const { return "workers"; }
+    };
+
+    CC_ASSERT(!static_config<malformed, parse_required>::is_constexpr::value);
+}
+
+int main() {
+
+    const auto& s = test3::parsed::get();
+    if (&s != &test3::parsed::get())
+        return 1;
+
+    if (s.size != 3 || s["workers"] != 4 || s["timeout_ms"] != 2500)
+        return 1;
+
+    return &test2::parsed::get() == &test2::parsed::value ? 0 : 1;
+}
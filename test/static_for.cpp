@@ -0,0 +1,141 @@
+/*!
+Copyright (c) 2016 Barrett Adair
+
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+*/
+
+#include <type_traits>
+#include <utility>
+#include "constexpr_checks/static_for.hpp"
+
+#ifndef CC_ASSERT
+#define CC_ASSERT(...) static_assert(__VA_ARGS__, #__VA_ARGS__)
+#endif //CC_ASSERT
+
+using namespace constexpr_checks;
+
+// a constexpr loop body that only depends on the index
+struct square {
+    template<typename I>
+    constexpr auto operator()(I) const -> decltype(I::value * I::value) {
+        return I::value * I::value;
+    }
+};
+
+// a loop body that can't be constant-evaluated
+struct print {
+    template<typename I>
+    auto operator()(I) const -> decltype(I::value) {
+        return I::value;
+    }
+};
+
+// only the first two iterations are constexpr
+struct partial {
+
+    template<std::size_t I, typename std::enable_if<
+        (I < 2), int>::type = 0>
+    constexpr int operator()(index_constant<I>) const { return 0; }
+
+    template<std::size_t I, typename std::enable_if<
+        (I >= 2), int>::type = 0>
+    int operator()(index_constant<I>) const { return 0; }
+};
+
+namespace test1 {
+
+    CC_ASSERT(std::is_same<decltype(unroll_folds<3, square>()),
+        std::integer_sequence<bool, true, true, true>>::value);
+
+    CC_ASSERT(std::is_same<decltype(unroll_folds<3>(print{})),
+        std::integer_sequence<bool, false, false, false>>::value);
+
+    CC_ASSERT(std::is_same<decltype(unroll_folds<4>(partial{})),
+        std::integer_sequence<bool, true, true, false, false>>::value);
+
+    CC_ASSERT(is_constexpr_unrollable<8, square>());
+    CC_ASSERT(is_constexpr_unrollable<0, print>());
+    CC_ASSERT(!is_constexpr_unrollable<1, print>());
+    CC_ASSERT(is_constexpr_unrollable<2>(partial{}));
+    CC_ASSERT(!is_constexpr_unrollable<3>(partial{}));
+}
+
+namespace test2 {
+
+    // records the order of the indices passed to the loop body, and
+    // whether they were compile-time constants
+    struct recorder {
+
+        std::size_t indices[8] = {};
+        std::size_t count = 0;
+        bool all_constant = true;
+
+        template<std::size_t I>
+        constexpr void operator()(index_constant<I>) {
+            indices[count++] = I;
+        }
+
+        constexpr void operator()(std::size_t i) {
+            indices[count++] = i;
+            all_constant = false;
+        }
+    };
+
+    template<std::size_t N, typename Policy = full_unroll>
+    constexpr recorder run() {
+        return unroll<N, Policy>(recorder{});
+    }
+
+    constexpr auto a = static_for<4>(recorder{});
+    CC_ASSERT(a.count == 4 && a.all_constant);
+    CC_ASSERT(a.indices[0] == 0 && a.indices[3] == 3);
+
+    constexpr auto b = static_for<0>(recorder{});
+    CC_ASSERT(b.count == 0);
+
+    constexpr auto c = run<8, unroll_limit<8>>();
+    CC_ASSERT(c.count == 8 && c.all_constant);
+
+    constexpr auto d = run<8, unroll_limit<7>>();
+    CC_ASSERT(d.count == 8 && !d.all_constant);
+    CC_ASSERT(d.indices[0] == 0 && d.indices[7] == 7);
+
+    constexpr auto e = run<8>();
+    CC_ASSERT(e.count == 8 && e.all_constant);
+}
+
+namespace test3 {
+
+    template<typename F, std::size_t N, typename Policy>
+    using unrolls = typename Policy::template unrolls<F, N>;
+
+    CC_ASSERT(unrolls<square, 8, unroll_if_constexpr<8>>::value);
+    CC_ASSERT(!unrolls<square, 9, unroll_if_constexpr<8>>::value);
+    CC_ASSERT(!unrolls<print, 8, unroll_if_constexpr<8>>::value);
+    CC_ASSERT(unrolls<partial, 2, unroll_if_constexpr<8>>::value);
+    CC_ASSERT(!unrolls<partial, 3, unroll_if_constexpr<8>>::value);
+    CC_ASSERT(unrolls<print, 8, unroll_limit<8>>::value);
+
+    // far above the budget, so no iteration is probed
+    CC_ASSERT(!unrolls<square, 20000, unroll_if_constexpr<64>>::value);
+}
+
+int main() {
+
+    // runtime loop bodies still work with every policy
+    int sum = 0;
+    auto add = [&sum](std::size_t i) { sum += static_cast<int>(i); };
+    unroll<4>(add);
+    unroll<4, unroll_limit<2>>(add);
+    unroll<4, unroll_if_constexpr<8>>(add);
+    static_for<4>(add);
+    if (sum != 24)
+        return 1;
+
+    // a long loop with a small budget runs as a runtime loop
+    std::size_t count = 0;
+    unroll<20000, unroll_if_constexpr<64>>(
+        [&count](std::size_t) { ++count; });
+    return count == 20000 ? 0 : 1;
+}
@@ -0,0 +1,195 @@
+/*!
+Copyright (c) 2016 Barrett Adair
+
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+*/
+
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <type_traits>
+#include "constexpr_checks/table.hpp"
+
+#ifndef CC_ASSERT
+#define CC_ASSERT(...) static_assert(__VA_ARGS__, #__VA_ARGS__)
+#endif //CC_ASSERT
+
+using constexpr_checks::static_table;
+using constexpr_checks::table_view;
+
+namespace test1 {
+
+    struct cube {
+        constexpr unsigned long operator()(std::size_t i) const {
+            return i * i * i;
+        }
+    };
+
+    using table = static_table<cube, 100>;
+
+    CC_ASSERT(table::is_constexpr::value);
+    CC_ASSERT(table::size() == 100);
+    CC_ASSERT(std::is_same<table::value_type, unsigned long>::value);
+    CC_ASSERT(table::value.data[0] == 0);
+    CC_ASSERT(table::value.data[99] == 970299);
+
+    constexpr table_view<unsigned long> view{ table::value.data, 100 };
+    CC_ASSERT(view[10] == 1000 && view.end() - view.begin() == 100);
+}
+
+namespace test2 {
+
+    // not constexpr, so generated on first use
+    struct runtime_square {
+        int operator()(std::size_t i) const {
+            return static_cast<int>(i * i);
+        }
+    };
+
+    using table = static_table<runtime_square, 10>;
+
+    CC_ASSERT(!table::is_constexpr::value);
+}
+
+#ifdef CONSTEXPR_CHECKS_MAPPED_TABLE
+
+namespace test3 {
+
+    struct point {
+        int x;
+        short y;
+    };
+
+    struct spiral {
+        constexpr point operator()(std::size_t i) const {
+            return { static_cast<int>(i) * 3, static_cast<short>(i % 7) };
+        }
+    };
+
+    constexpr std::size_t size = 5000;
+
+    std::string path;
+
+    struct table_path {
+        const char* operator()() const { return path.c_str(); }
+    };
+
+    template<int>
+    struct other_path {
+        const char* operator()() const { return path.c_str(); }
+    };
+
+    using compiled = static_table<spiral, size>;
+    using mapped = constexpr_checks::mapped_table<spiral, size, table_path>;
+
+    CC_ASSERT(compiled::is_constexpr::value);
+    CC_ASSERT(!mapped::is_constexpr::value);
+    CC_ASSERT(std::is_same<decltype(mapped::get()),
+        decltype(compiled::get())>::value);
+
+    template<typename Table>
+    bool fails() {
+        try {
+            Table::get();
+        } catch (const constexpr_checks::table_error&) {
+            return true;
+        }
+        return false;
+    }
+
+    int run() {
+
+        char name[] = "/tmp/constexpr_checks_tableXXXXXX";
+        int fd = ::mkstemp(name);
+        if (fd < 0)
+            return 1;
+        ::close(fd);
+        path = name;
+
+        constexpr_checks::write_table<spiral, size>(name);
+
+        // the padding of every point is zero, so the file is reproducible
+        const std::size_t offset = constexpr_checks::detail::table_data_offset;
+        std::FILE* f = std::fopen(name, "rb");
+        if (f == nullptr)
+            return 1;
+        std::string first(offset + size * sizeof(point), '\0');
+        std::size_t read = std::fread(&first[0], 1, first.size(), f);
+        std::fclose(f);
+        if (read != first.size())
+            return 1;
+        for (std::size_t i = 0; i < size; ++i) {
+            for (std::size_t b = sizeof(int) + sizeof(short);
+                    b < sizeof(point); ++b) {
+                if (first[offset + i * sizeof(point) + b] != '\0')
+                    return 1;
+            }
+        }
+
+        constexpr_checks::write_table<spiral, size>(name);
+
+        f = std::fopen(name, "rb");
+        if (f == nullptr)
+            return 1;
+        std::string second(first.size(), '\0');
+        read = std::fread(&second[0], 1, second.size(), f);
+        std::fclose(f);
+        if (read != second.size() || first != second)
+            return 1;
+
+        auto view = mapped::get();
+        if (view.size() != size || view.data() != mapped::get().data())
+            return 1;
+
+        for (std::size_t i = 0; i < size; ++i) {
+            if (view[i].x != compiled::get()[i].x
+                || view[i].y != compiled::get()[i].y)
+                return 1;
+        }
+
+        // another count
+        if (!fails<constexpr_checks::mapped_table<
+                spiral, size - 1, other_path<0>>>())
+            return 1;
+
+        // a flipped byte
+        f = std::fopen(name, "r+b");
+        if (f == nullptr || std::fseek(f, 100, SEEK_SET) != 0)
+            return 1;
+        std::fputc('!', f);
+        std::fclose(f);
+
+        if (!fails<constexpr_checks::mapped_table<
+                spiral, size, other_path<1>>>())
+            return 1;
+
+        std::remove(name);
+
+        if (!fails<constexpr_checks::mapped_table<
+                spiral, size, other_path<2>>>())
+            return 1;
+
+        return 0;
+    }
+}
+
+#endif //#ifdef CONSTEXPR_CHECKS_MAPPED_TABLE
+
+int main() {
+
+    auto squares = test2::table::get();
+    if (squares.size() != 10 || squares[9] != 81)
+        return 1;
+
+    if (test1::table::get().data() != test1::table::value.data)
+        return 1;
+
+#ifdef CONSTEXPR_CHECKS_MAPPED_TABLE
+    return test3::run();
+#else
+    return 0;
+#endif
+}
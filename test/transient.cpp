@@ -0,0 +1,102 @@
+/*!
+Copyright (c) 2016 Barrett Adair
+
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+*/
+
+#include <type_traits>
+#include <string>
+#include <vector>
+#include "constexpr_checks/transient.hpp"
+
+#ifndef CC_ASSERT
+#define CC_ASSERT(...) static_assert(__VA_ARGS__, #__VA_ARGS__)
+#endif //CC_ASSERT
+
+#if defined(__cpp_constexpr_dynamic_alloc) \
+    && defined(__cpp_lib_constexpr_vector) \
+    && defined(__cpp_lib_constexpr_string)
+
+using constexpr_checks::constexpr_array;
+using constexpr_checks::is_constexpr_transient;
+using constexpr_checks::to_constexpr_array;
+
+template<int I>
+using int_ = std::integral_constant<int, I>;
+
+namespace test1 {
+
+    struct squares {
+        constexpr std::vector<int> operator()(int n) const {
+            std::vector<int> v;
+            for (int i = 0; i < n; ++i)
+                v.push_back(i * i);
+            return v;
+        }
+    };
+
+    CC_ASSERT(is_constexpr_transient<squares, int_<5>>());
+    CC_ASSERT(is_constexpr_transient<int_<5>>(squares{}));
+
+    constexpr auto a = to_constexpr_array<squares, int_<5>>();
+    CC_ASSERT(std::is_same<decltype(a), const std::array<int, 5>>::value);
+    CC_ASSERT(a[0] == 0 && a[2] == 4 && a[4] == 16);
+
+    CC_ASSERT(constexpr_array<squares, int_<3>>.size() == 3);
+    CC_ASSERT(constexpr_array<squares, int_<3>>[2] == 4);
+}
+
+namespace test2 {
+
+    constexpr std::string greeting() {
+        std::string s = "hello";
+        s += ", world";
+        return s;
+    }
+
+    using greeting_c = std::integral_constant<decltype(&greeting), &greeting>;
+
+    CC_ASSERT(is_constexpr_transient<greeting_c>());
+
+    constexpr auto a = to_constexpr_array<greeting_c>();
+    CC_ASSERT(a.size() == 12);
+    CC_ASSERT(a[0] == 'h' && a[11] == 'd');
+}
+
+namespace test3 {
+
+    int counter = 0;
+
+    // runtime-only: reads a non-constexpr global
+    struct runtime_only {
+        std::vector<int> operator()() const {
+            return std::vector<int>(counter);
+        }
+    };
+
+    CC_ASSERT(!is_constexpr_transient<runtime_only>());
+
+    // the allocation outlives the constant evaluation
+    struct leaks {
+        constexpr int* operator()() const {
+            return new int(1);
+        }
+    };
+
+    CC_ASSERT(!is_constexpr_transient<leaks>());
+
+    // reads past the end of the allocation
+    struct out_of_range {
+        constexpr int operator()() const {
+            std::vector<int> v(2);
+            return *(v.data() + 2);
+        }
+    };
+
+    CC_ASSERT(!is_constexpr_transient<out_of_range>());
+}
+
+#endif
+
+int main() {}
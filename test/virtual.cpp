@@ -0,0 +1,95 @@
+/*!
+Copyright (c) 2016 Barrett Adair
+
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+*/
+
+#include <type_traits>
+#include <utility>
+#include "constexpr_checks/virtual.hpp"
+
+#ifndef CC_ASSERT
+#define CC_ASSERT(...) static_assert(__VA_ARGS__, #__VA_ARGS__)
+#endif //CC_ASSERT
+
+#if defined(__cpp_constexpr) && __cpp_constexpr >= 201907L
+
+using constexpr_checks::constexpr_overrides;
+using constexpr_checks::virtual_dispatch_table;
+
+namespace test1 {
+
+    // no virtual destructor: GCC 12 rejects constexpr objects whose
+    // implicit destructor is virtual ("used before its definition")
+    struct policy {
+        constexpr virtual int scale(int i) const { return i; }
+        constexpr virtual int id() const noexcept = 0;
+    };
+
+    struct twice : policy {
+        constexpr int scale(int i) const override { return i * 2; }
+        constexpr int id() const noexcept override { return 2; }
+    };
+
+    struct thrice : policy {
+        constexpr int scale(int i) const override { return i * 3; }
+        constexpr int id() const noexcept override { return 3; }
+    };
+
+    int runtime_factor = 4;
+
+    struct runtime : policy {
+        int scale(int i) const override { return i * runtime_factor; }
+        constexpr int id() const noexcept override { return 4; }
+    };
+
+    struct unrelated {
+        constexpr int scale(int i) const { return i; }
+    };
+
+    // abstract
+    CC_ASSERT(std::is_same<
+        decltype(constexpr_overrides<&policy::scale, policy>()),
+        std::integer_sequence<bool, false>>::value);
+
+    CC_ASSERT(std::is_same<
+        decltype(constexpr_overrides<&policy::scale,
+            twice, thrice, runtime, unrelated>()),
+        std::integer_sequence<bool, true, true, false, false>>::value);
+
+    CC_ASSERT(std::is_same<
+        decltype(constexpr_overrides<&policy::id, twice, thrice, runtime>()),
+        std::integer_sequence<bool, true, true, true>>::value);
+
+    using scale_c = std::integral_constant<decltype(&policy::scale),
+        &policy::scale>;
+
+    CC_ASSERT(std::is_same<
+        decltype(constexpr_overrides<scale_c, twice, runtime>()),
+        std::integer_sequence<bool, true, false>>::value);
+
+    using scales = virtual_dispatch_table<scale_c, twice, thrice>;
+    using ids = virtual_dispatch_table<std::integral_constant<
+        decltype(&policy::id), &policy::id>, twice, thrice, runtime>;
+
+    CC_ASSERT(scales::size() == 2);
+    CC_ASSERT(scales::value[0](5) == 10);
+    CC_ASSERT(scales::value[1](5) == 15);
+    CC_ASSERT(ids::value[2]() == 4);
+}
+
+int main() {
+
+    using namespace test1;
+
+    // the index would normally come from configuration or input
+    volatile std::size_t index = 1;
+    return scales::value[index](7) == 21 ? 0 : 1;
+}
+
+#else
+
+int main() {}
+
+#endif
@@ -0,0 +1,135 @@
+/*!
+Copyright (c) 2016 Barrett Adair
+
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+*/
+
+#include <string>
+#include <type_traits>
+#include "constexpr_checks/visit.hpp"
+
+#ifndef CC_ASSERT
+#define CC_ASSERT(...) static_assert(__VA_ARGS__, #__VA_ARGS__)
+#endif //CC_ASSERT
+
+#ifdef __cpp_lib_variant
+
+using constexpr_checks::constexpr_visit;
+using constexpr_checks::is_constexpr_visitor;
+
+namespace test1 {
+
+    struct size_of {
+        template<typename T>
+        constexpr std::size_t operator()(const T&) const {
+            return sizeof(T);
+        }
+    };
+
+    using message = std::variant<char, int, double>;
+
+    CC_ASSERT(is_constexpr_visitor<size_of, message>());
+    CC_ASSERT(is_constexpr_visitor<size_of, const message&>());
+
+    // folds when the variant is a constant
+    constexpr message m = 1.0;
+    CC_ASSERT(constexpr_visit(size_of{}, m) == sizeof(double));
+    CC_ASSERT(constexpr_visit(size_of{}, message{ 'a' }) == 1);
+}
+
+namespace test2 {
+
+    int calls = 0;
+
+    // not constexpr, so it is visited with branches
+    struct count {
+        template<typename T>
+        double operator()(T& t) const {
+            ++calls;
+            return static_cast<double>(t);
+        }
+    };
+
+    using message = std::variant<char, int, double>;
+
+    CC_ASSERT(!is_constexpr_visitor<count, message&>());
+
+    // not constexpr-constructible, so never constexpr-invokable
+    struct by_string {
+        int operator()(const std::string& s) const {
+            return static_cast<int>(s.size());
+        }
+        int operator()(int i) const { return i; }
+    };
+
+    // a constexpr visitor that takes its alternative by lvalue reference
+    struct twice {
+        template<typename T>
+        constexpr T operator()(T& t) const { return t + t; }
+    };
+
+    using small = std::variant<char, int>;
+
+    CC_ASSERT(is_constexpr_visitor<twice, small&>());
+
+    CC_ASSERT(!is_constexpr_visitor<by_string,
+        const std::variant<int, std::string>&>());
+}
+
+namespace test3 {
+
+    template<std::size_t I>
+    struct tag { int value = I; };
+
+    // more alternatives than CONSTEXPR_CHECKS_VISIT_SWITCH_LIMIT
+    using wide = std::variant<tag<0>, tag<1>, tag<2>, tag<3>, tag<4>,
+        tag<5>, tag<6>, tag<7>, tag<8>, tag<9>>;
+
+    struct runtime_value {
+        template<typename T>
+        int operator()(T& t) const {
+            return t.value;
+        }
+    };
+
+    CC_ASSERT(!is_constexpr_visitor<runtime_value, wide&>());
+}
+
+int main() {
+
+    using namespace test2;
+    message m = 'x';
+    if (constexpr_visit(count{}, m) != 'x' || calls != 1)
+        return 1;
+
+    m = 2.5;
+    if (constexpr_visit(count{}, m) != 2.5 || calls != 2)
+        return 1;
+
+    std::variant<int, std::string> s = std::string("four");
+    if (constexpr_visit(by_string{}, s) != 4)
+        return 1;
+
+    test3::wide w = test3::tag<7>{};
+    if (constexpr_visit(test3::runtime_value{}, w) != 7)
+        return 1;
+
+    // rvalue variants are forwarded to the visitor
+    struct take {
+        std::string operator()(std::string&& s) const { return std::move(s); }
+        std::string operator()(int) const { return {}; }
+    };
+
+    if (constexpr_visit(take{}, std::variant<int, std::string>("moved"))
+        != "moved")
+        return 1;
+
+    return 0;
+}
+
+#else
+
+int main() {}
+
+#endif //#ifdef __cpp_lib_variant
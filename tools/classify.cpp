@@ -0,0 +1,465 @@
+/*<-
+Copyright Barrett Adair 2016
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http ://boost.org/LICENSE_1_0.txt)
+->*/
+
+// classify evaluates is_constexpr_invokable for a list of probes, each in
+// its own compiler process, and writes a header of
+// constexpr_checks::classified specializations (see
+// constexpr_checks/classified.hpp). A callable that is not
+// SFINAE-friendly makes the query a hard error, which would break any
+// translation unit that asks it directly. Here, it only fails that one
+// probe, which is recorded as hard_error.
+//
+// Build with g++ -std=c++17 -O2 -pthread tools/classify.cpp -o classify
+//
+// Usage: classify [options] probes.txt
+//
+//   -o FILE       write the header to FILE instead of stdout
+//   --cxx CMD     compiler for the probes (default: $CXX, or c++)
+//   --flags ARGS  compiler flags for the probes, such as the language
+//                 standard and the include paths of this library,
+//                 callable_traits and the probed code
+//   -j N          compile N probes at a time (default: one per core)
+//   --cache DIR   result cache (default: .classify-cache)
+//
+// Each line of the probe list is one of:
+//
+//   // a comment
+//   #include <legacy/math.hpp>       (any preprocessor directive)
+//   name | callable type | argument type | argument type ...
+//
+// The directives make up the preamble of every probe and of the
+// generated header. The callable type is anything is_constexpr_invokable
+// accepts, such as a function object type or an std::integral_constant
+// of a function pointer. The name is only used in comments and messages.
+//
+// Every probe is compiled with -fsyntax-only, first with
+// static_assert(is_constexpr_invokable<...>()), then, if that fails,
+// without it: the probe is constexpr_invokable if the first compile
+// succeeds, not_constexpr_invokable if only the second does, and a
+// hard_error otherwise. If the types themselves do not compile, the probe
+// is reported as invalid and left out of the header. Before any probe,
+// the preamble and this library are compiled on their own, and classify
+// fails if they do not compile.
+//
+// Results are cached by a hash of the compiler, the flags and the
+// preprocessed probe, so a probe is compiled again only when the probed
+// code, its headers or this library change.
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <set>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+#include <unistd.h>
+
+namespace fs = std::filesystem;
+
+namespace {
+
+    enum class result {
+        constexpr_invokable,
+        not_constexpr_invokable,
+        hard_error,
+        invalid
+    };
+
+    const char* const result_names[] = {
+        "constexpr_invokable",
+        "not_constexpr_invokable",
+        "hard_error",
+        "invalid"
+    };
+
+    struct probe {
+        std::string name;
+        std::string types; // "callable, args..."
+        result value = result::invalid;
+        bool cached = false;
+    };
+
+    struct options {
+        std::string input;
+        std::string output;
+        std::string cxx;
+        std::string flags;
+        std::string cache = ".classify-cache";
+        unsigned jobs = 0;
+    };
+
+    std::string trim(const std::string& s) {
+        auto first = s.find_first_not_of(" \t\r\n");
+        if (first == std::string::npos)
+            return {};
+        auto last = s.find_last_not_of(" \t\r\n");
+        return s.substr(first, last - first + 1);
+    }
+
+    std::string quote(const std::string& s) {
+        std::string quoted = "'";
+        for (char c : s) {
+            if (c == '\'')
+                quoted += "'\\''";
+            else
+                quoted += c;
+        }
+        return quoted + "'";
+    }
+
+    // 64-bit FNV-1a
+    std::uint64_t hash(const std::string& s,
+        std::uint64_t h = 0xcbf29ce484222325u) {
+        for (unsigned char c : s)
+            h = (h ^ c) * 0x100000001b3u;
+        return h;
+    }
+
+    std::string hex(std::uint64_t h) {
+        char buffer[17];
+        std::snprintf(buffer, sizeof(buffer), "%016llx",
+            static_cast<unsigned long long>(h));
+        return buffer;
+    }
+
+    bool read_file(const fs::path& path, std::string& contents) {
+        std::ifstream in(path, std::ios::binary);
+        if (!in)
+            return false;
+        contents.assign(std::istreambuf_iterator<char>(in),
+            std::istreambuf_iterator<char>());
+        return true;
+    }
+
+    bool write_file(const fs::path& path, const std::string& contents) {
+        std::ofstream out(path, std::ios::binary | std::ios::trunc);
+        out << contents;
+        return static_cast<bool>(out.flush());
+    }
+
+    bool parse_probes(const std::string& path, std::string& preamble,
+        std::vector<probe>& probes) {
+
+        std::ifstream in(path);
+        if (!in) {
+            std::cerr << "classify: cannot read " << path << "\n";
+            return false;
+        }
+
+        std::set<std::string> seen;
+        std::string line;
+        for (int number = 1; std::getline(in, line); ++number) {
+
+            line = trim(line);
+            if (line.empty() || line.compare(0, 2, "//") == 0)
+                continue;
+
+            if (line[0] == '#') {
+                preamble += line + "\n";
+                continue;
+            }
+
+            std::vector<std::string> fields;
+            std::istringstream fields_in(line);
+            for (std::string field; std::getline(fields_in, field, '|');)
+                fields.push_back(trim(field));
+
+            if (fields.size() < 2 || fields[0].empty() || fields[1].empty()) {
+                std::cerr << path << ":" << number
+                    << ": expected 'name | callable | args...'\n";
+                return false;
+            }
+
+            probe p;
+            p.name = fields[0];
+            p.types = fields[1];
+            for (std::size_t i = 2; i < fields.size(); ++i)
+                p.types += ", " + fields[i];
+
+            // the header cannot specialize classified twice
+            if (!seen.insert(p.types).second) {
+                std::cerr << path << ":" << number << ": warning: "
+                    << p.name << " repeats an earlier probe\n";
+                continue;
+            }
+
+            probes.push_back(std::move(p));
+        }
+
+        return true;
+    }
+
+    class classifier {
+
+        const options& o_;
+        const std::string& preamble_;
+        fs::path work_;
+
+        bool run(const std::string& command, bool quiet = true) const {
+            return std::system((command + (quiet ? " >/dev/null 2>&1"
+                : " >/dev/null")).c_str()) == 0;
+        }
+
+        bool compile(const fs::path& source, bool quiet = true) const {
+            return run(o_.cxx + " " + o_.flags + " -fsyntax-only "
+                + quote(source.string()), quiet);
+        }
+
+        // the preamble and this library, without any probe
+        std::string library() const {
+            return preamble_ + "#include \"constexpr_checks.hpp\"\n";
+        }
+
+        std::string query(const probe& p, bool assert) const {
+            std::string source = library()
+                + "using cc_probe = decltype(::constexpr_checks::"
+                + "is_constexpr_invokable<" + p.types + ">());\n";
+            if (assert)
+                source += "static_assert(cc_probe::value, \"\");\n";
+            return source;
+        }
+
+        std::string types(const probe& p) const {
+            return library() + "template<typename...> struct cc_types;\n"
+                + "using cc_probe = cc_types<" + p.types + ">;\n";
+        }
+
+        result compile_probe(const probe& p, const fs::path& source) const {
+
+            if (write_file(source, query(p, true)) && compile(source))
+                return result::constexpr_invokable;
+
+            if (write_file(source, query(p, false)) && compile(source))
+                return result::not_constexpr_invokable;
+
+            if (write_file(source, types(p)) && compile(source))
+                return result::hard_error;
+
+            return result::invalid;
+        }
+
+    public:
+
+        classifier(const options& o, const std::string& preamble,
+            const fs::path& work)
+            : o_(o), preamble_(preamble), work_(work) {}
+
+        // Compiles the preamble and this library on their own, showing
+        // any errors. If this fails, e.g. because of a wrong include
+        // path, every probe would fail too and be misreported as a
+        // hard_error or invalid.
+        bool check_setup() const {
+            const fs::path source = work_ / "setup.cpp";
+            return write_file(source, library()) && compile(source, false);
+        }
+
+        void classify(probe& p, std::size_t index) const {
+
+            const fs::path source = work_ / (std::to_string(index) + ".cpp");
+            const fs::path preprocessed =
+                work_ / (std::to_string(index) + ".i");
+
+            // -P omits line markers, which would name the work file
+            std::string contents;
+            if (!write_file(source, query(p, true))
+                || !run(o_.cxx + " " + o_.flags + " -E -P "
+                    + quote(source.string()) + " -o "
+                    + quote(preprocessed.string()))
+                || !read_file(preprocessed, contents)) {
+                p.value = compile_probe(p, source);
+                return;
+            }
+
+            const fs::path entry = fs::path(o_.cache) / hex(hash(contents,
+                hash(o_.cxx + "\n" + o_.flags + "\n")));
+
+            std::string cached;
+            if (read_file(entry, cached)) {
+                for (int r = 0; r < 3; ++r) {
+                    if (trim(cached) == result_names[r]) {
+                        p.value = static_cast<result>(r);
+                        p.cached = true;
+                        return;
+                    }
+                }
+            }
+
+            p.value = compile_probe(p, source);
+            if (p.value == result::invalid)
+                return;
+
+            // written aside and renamed, so that concurrent runs never
+            // see a partial entry
+            const fs::path tmp = work_ / (std::to_string(index) + ".result");
+            const std::string name = result_names[static_cast<int>(p.value)];
+            if (write_file(tmp, name + "\n")) {
+                std::error_code ignored;
+                fs::rename(tmp, entry, ignored);
+            }
+        }
+    };
+
+    std::string guard_for(const std::string& output) {
+        std::string guard = "CONSTEXPR_CHECKS_CLASSIFIED_";
+        std::string name = output.empty() ? std::string("probes")
+            : fs::path(output).filename().string();
+        for (char c : name) {
+            if (('a' <= c && c <= 'z'))
+                guard += static_cast<char>(c - 'a' + 'A');
+            else if (('A' <= c && c <= 'Z') || ('0' <= c && c <= '9'))
+                guard += c;
+            else
+                guard += '_';
+        }
+        return guard;
+    }
+
+    std::string header(const options& o, const std::string& preamble,
+        const std::vector<probe>& probes) {
+
+        std::string guard = guard_for(o.output);
+        std::ostringstream out;
+
+        out << "// Generated by tools/classify from "
+            << fs::path(o.input).filename().string() << ". Do not edit.\n\n"
+            << "#ifndef " << guard << "\n#define " << guard << "\n\n"
+            << preamble
+            << "#include \"constexpr_checks/classified.hpp\"\n\n"
+            << "namespace constexpr_checks {\n";
+
+        for (const probe& p : probes) {
+            out << "\n    // " << p.name << "\n";
+            if (p.value == result::invalid) {
+                out << "    // invalid: the types do not compile\n";
+                continue;
+            }
+            out << "    template<>\n"
+                << "    struct classified<" << p.types << ">\n"
+                << "        : std::integral_constant<probe_result,\n"
+                << "            probe_result::"
+                << result_names[static_cast<int>(p.value)] << "> {};\n";
+        }
+
+        out << "}\n\n#endif //#ifndef " << guard << "\n";
+        return out.str();
+    }
+
+    bool parse_options(int argc, char** argv, options& o) {
+
+        for (int i = 1; i < argc; ++i) {
+            std::string arg = argv[i];
+            bool has_value = i + 1 < argc;
+            if (arg == "-o" && has_value)
+                o.output = argv[++i];
+            else if (arg == "--cxx" && has_value)
+                o.cxx = argv[++i];
+            else if (arg == "--flags" && has_value)
+                o.flags = argv[++i];
+            else if (arg == "--cache" && has_value)
+                o.cache = argv[++i];
+            else if (arg == "-j" && has_value)
+                o.jobs = static_cast<unsigned>(std::atoi(argv[++i]));
+            else if (arg[0] != '-' && o.input.empty())
+                o.input = arg;
+            else
+                return false;
+        }
+
+        if (o.cxx.empty()) {
+            const char* cxx = std::getenv("CXX");
+            o.cxx = cxx != nullptr && *cxx != '\0' ? cxx : "c++";
+        }
+
+        if (o.jobs == 0)
+            o.jobs = std::max(1u, std::thread::hardware_concurrency());
+
+        return !o.input.empty();
+    }
+}
+
+int main(int argc, char** argv) {
+
+    options o;
+    if (!parse_options(argc, argv, o)) {
+        std::cerr << "usage: classify [-o FILE] [--cxx CMD] [--flags ARGS] "
+            "[-j N] [--cache DIR] probes.txt\n";
+        return 1;
+    }
+
+    std::string preamble;
+    std::vector<probe> probes;
+    if (!parse_probes(o.input, preamble, probes))
+        return 1;
+
+    // one work directory per process, so that several runs can share
+    // the cache
+    const fs::path work = fs::path(o.cache)
+        / ("work." + std::to_string(::getpid()));
+
+    std::error_code error;
+    fs::create_directories(work, error);
+    if (error) {
+        std::cerr << "classify: cannot create " << work.string() << ": "
+            << error.message() << "\n";
+        return 1;
+    }
+
+    const classifier c(o, preamble, work);
+
+    if (!c.check_setup()) {
+        std::cerr << "classify: the preamble and constexpr_checks.hpp do "
+            "not compile with --cxx and --flags\n";
+        fs::remove_all(work, error);
+        return 1;
+    }
+    std::atomic<std::size_t> next{ 0 };
+    std::vector<std::thread> workers;
+
+    for (unsigned j = 0; j < o.jobs && j < probes.size(); ++j) {
+        workers.emplace_back([&] {
+            for (std::size_t i; (i = next++) < probes.size();)
+                c.classify(probes[i], i);
+        });
+    }
+
+    for (std::thread& t : workers)
+        t.join();
+
+    fs::remove_all(work, error);
+
+    std::size_t counts[4] = {};
+    std::size_t cached = 0;
+    for (const probe& p : probes) {
+        ++counts[static_cast<int>(p.value)];
+        cached += p.cached;
+        if (p.value == result::invalid)
+            std::cerr << "classify: warning: " << p.name
+                << ": the types do not compile\n";
+    }
+
+    std::cerr << "classify: " << probes.size() << " probes (" << cached
+        << " cached): " << counts[0] << " constexpr, " << counts[1]
+        << " not constexpr, " << counts[2] << " hard errors, "
+        << counts[3] << " invalid\n";
+
+    const std::string text = header(o, preamble, probes);
+
+    if (o.output.empty()) {
+        std::cout << text;
+    } else if (!write_file(o.output, text)) {
+        std::cerr << "classify: cannot write " << o.output << "\n";
+        return 1;
+    }
+
+    return 0;
+}